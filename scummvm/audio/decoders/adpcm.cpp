@@ -209,43 +209,58 @@ int Apple_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
 #pragma mark -
 
 
-int MSIma_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
-	// Need to write at least one sample per channel
-	assert((numSamples % _channels) == 0);
+BlockADPCMStream::BlockADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign, ADPCMType type)
+	: ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign),
+		_type(type),
+		_blockData(0),
+		_blockSamples(0),
+		_sampleCount(0),
+		_samplePos(0) {
+}
 
-	int samples = 0;
+BlockADPCMStream::~BlockADPCMStream() {
+	delete[] _blockData;
+	delete[] _blockSamples;
+}
 
-	while (samples < numSamples && !_stream->eos() && _stream->pos() < _endpos) {
-		if (_blockPos[0] == _blockAlign) {
-			for (int i = 0; i < _channels; i++) {
-				// read block header
-				_status.ima_ch[i].last = _stream->readSint16LE();
-				_status.ima_ch[i].stepIndex = _stream->readSint16LE();
-			}
+void BlockADPCMStream::reset() {
+	ADPCMStream::reset();
+	_sampleCount = 0;
+	_samplePos = 0;
+}
 
-			_blockPos[0] = _channels * 4;
-		}
+bool BlockADPCMStream::readBlock() {
+	if (ADPCMStream::endOfData())
+		return false;
 
-		// Decode a set of samples
-		for (int i = 0; i < _channels; i++) {
-			// The stream encodes four bytes per channel at a time
-			for (int j = 0; j < 4; j++) {
-				byte data = _stream->readByte();
-				_blockPos[0]++;
-				_buffer[i][j * 2] = decodeIMA(data & 0x0f, i);
-				_buffer[i][j * 2 + 1] = decodeIMA((data >> 4) & 0x0f, i);
-				_samplesLeft[i] += 2;
-			}
-		}
+	if (!_blockData) {
+		_blockData = new byte[_blockAlign];
+		_blockSamples = new int16[getADPCMBlockSamples(_type, _blockAlign, _channels)];
+	}
 
-		while (samples < numSamples && _samplesLeft[0] != 0) {
-			for (int i = 0; i < _channels; i++) {
-				buffer[samples + i] = _buffer[i][8 - _samplesLeft[i]];
-				_samplesLeft[i]--;
-			}
+	const uint32 size = _stream->read(_blockData, MIN<uint32>(_blockAlign, _endpos - _stream->pos()));
+	if (size == 0)
+		return false;
+
+	_sampleCount = MAX(decodeADPCMBlock(_type, _blockData, size, _channels, _blockSamples), 0);
+	_samplePos = 0;
+	return true;
+}
 
-			samples += _channels;
+int BlockADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
+	int samples = 0;
+
+	while (samples < numSamples) {
+		if (_samplePos == _sampleCount) {
+			if (!readBlock())
+				break;
+			continue;
 		}
+
+		const uint32 count = MIN<uint32>(numSamples - samples, _sampleCount - _samplePos);
+		memcpy(buffer + samples, _blockSamples + _samplePos, count * sizeof(int16));
+		_samplePos += count;
+		samples += count;
 	}
 
 	return samples;
@@ -268,67 +283,143 @@ static const int MSADPCMAdaptationTable[] = {
 	768, 614, 512, 409, 307, 230, 230, 230
 };
 
-int16 MS_ADPCMStream::decodeMS(ADPCMChannelStatus *c, byte code) {
-	int32 predictor;
+namespace {
 
-	predictor = (((c->sample1) * (c->coeff1)) + ((c->sample2) * (c->coeff2))) / 256;
-	predictor += (signed)((code & 0x08) ? (code - 0x10) : (code)) * c->delta;
+inline int16 decodeIMANibble(int32 &last, int32 &stepIndex, byte code) {
+	// The product is never negative, so the division is a plain shift, and
+	// the sign of the nibble is applied without a branch
+	const int32 E = ((2 * (code & 0x7) + 1) * Ima_ADPCMStream::_imaTable[stepIndex]) >> 3;
+	const int32 sign = -(int32)(code >> 3);
+	last = CLIP<int32>(last + ((E ^ sign) - sign), -32768, 32767);
+	stepIndex = CLIP<int32>(stepIndex + ADPCMStream::_stepAdjustTable[code], 0, ARRAYSIZE(Ima_ADPCMStream::_imaTable) - 1);
+
+	return last;
+}
+
+struct MSChannelStatus {
+	int16 delta;
+	int16 coeff1;
+	int16 coeff2;
+	int16 sample1;
+	int16 sample2;
+};
 
+inline int16 decodeMSNibble(MSChannelStatus &c, byte code) {
+	int32 predictor = (c.sample1 * c.coeff1 + c.sample2 * c.coeff2) / 256;
+	// (code ^ 8) - 8 sign-extends the nibble
+	predictor += ((code ^ 0x08) - 0x08) * c.delta;
 	predictor = CLIP<int32>(predictor, -32768, 32767);
 
-	c->sample2 = c->sample1;
-	c->sample1 = predictor;
-	c->delta = (MSADPCMAdaptationTable[(int)code] * c->delta) >> 8;
+	c.sample2 = c.sample1;
+	c.sample1 = predictor;
+	c.delta = (MSADPCMAdaptationTable[code] * c.delta) >> 8;
 
-	if (c->delta < 16)
-		c->delta = 16;
+	if (c.delta < 16)
+		c.delta = 16;
 
 	return (int16)predictor;
 }
 
-int MS_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
-	int samples;
-	byte data;
-	int i;
+// Microsoft IMA ADPCM: a header of four bytes per channel, followed by groups
+// of four bytes per channel, each holding eight samples of that channel.
+// Contrary to the specification, the header sample is not played.
+int decodeMSImaBlock(const byte *block, uint32 blockSize, int channels, int16 *output) {
+	const uint32 headerSize = 4 * channels;
+	if (blockSize < headerSize)
+		return 0;
 
-	for (samples = 0; samples < numSamples && !endOfData(); samples++) {
-		if (_decodedSampleCount == 0) {
-			if (_blockPos[0] == _blockAlign) {
-				// read block header
-				for (i = 0; i < _channels; i++) {
-					_status.ch[i].predictor = CLIP(_stream->readByte(), (byte)0, (byte)6);
-					_status.ch[i].coeff1 = MSADPCMAdaptCoeff1[_status.ch[i].predictor];
-					_status.ch[i].coeff2 = MSADPCMAdaptCoeff2[_status.ch[i].predictor];
-				}
-
-				for (i = 0; i < _channels; i++)
-					_status.ch[i].delta = _stream->readSint16LE();
-
-				for (i = 0; i < _channels; i++)
-					_status.ch[i].sample1 = _stream->readSint16LE();
-
-				for (i = 0; i < _channels; i++)
-					_decodedSamples[_decodedSampleCount++] = _status.ch[i].sample2 = _stream->readSint16LE();
-
-				for (i = 0; i < _channels; i++)
-					_decodedSamples[_decodedSampleCount++] = _status.ch[i].sample1;
-
-				_blockPos[0] = _channels * 7;
-			} else {
-				data = _stream->readByte();
-				_blockPos[0]++;
-				_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[0], (data >> 4) & 0x0f);
-				_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[_channels - 1], data & 0x0f);
+	int32 last[2], stepIndex[2];
+	for (int i = 0; i < channels; i++) {
+		last[i] = (int16)READ_LE_UINT16(block + 4 * i);
+		stepIndex[i] = CLIP<int32>((int16)READ_LE_UINT16(block + 4 * i + 2), 0, ARRAYSIZE(Ima_ADPCMStream::_imaTable) - 1);
+	}
+
+	const uint32 groups = (blockSize - headerSize) / headerSize;
+	const byte *data = block + headerSize;
+
+	for (uint32 g = 0; g < groups; g++) {
+		for (int i = 0; i < channels; i++) {
+			int16 *out = output + i;
+			for (int j = 0; j < 4; j++) {
+				const byte code = *data++;
+				out[0] = decodeIMANibble(last[i], stepIndex[i], code & 0x0f);
+				out[channels] = decodeIMANibble(last[i], stepIndex[i], code >> 4);
+				out += 2 * channels;
 			}
-			_decodedSampleIndex = 0;
 		}
+		output += 8 * channels;
+	}
 
-		// _decodedSamples acts as a FIFO of depth 2 or 4;
-		buffer[samples] = _decodedSamples[_decodedSampleIndex++];
-		_decodedSampleCount--;
+	return groups * 8 * channels;
+}
+
+// Microsoft ADPCM: a header of seven bytes per channel, which includes the
+// first two samples, followed by one byte per sample frame in stereo or one
+// byte per two samples in mono.
+int decodeMSBlock(const byte *block, uint32 blockSize, int channels, int16 *output) {
+	const uint32 headerSize = 7 * channels;
+	if (blockSize < headerSize)
+		return 0;
+
+	MSChannelStatus status[2];
+	for (int i = 0; i < channels; i++) {
+		const byte predictor = MIN<byte>(block[i], 6);
+		status[i].coeff1 = MSADPCMAdaptCoeff1[predictor];
+		status[i].coeff2 = MSADPCMAdaptCoeff2[predictor];
+		status[i].delta = READ_LE_UINT16(block + channels + 2 * i);
+		status[i].sample1 = READ_LE_UINT16(block + 3 * channels + 2 * i);
+		status[i].sample2 = READ_LE_UINT16(block + 5 * channels + 2 * i);
 	}
 
-	return samples;
+	int16 *out = output;
+	for (int i = 0; i < channels; i++)
+		*out++ = status[i].sample2;
+	for (int i = 0; i < channels; i++)
+		*out++ = status[i].sample1;
+
+	// The high nibble belongs to the first channel, the low nibble to the
+	// last one, which is the same channel for mono
+	MSChannelStatus &first = status[0];
+	MSChannelStatus &second = status[channels - 1];
+	const byte *data = block + headerSize;
+	const byte *end = block + blockSize;
+	while (data < end) {
+		const byte code = *data++;
+		*out++ = decodeMSNibble(first, code >> 4);
+		*out++ = decodeMSNibble(second, code & 0x0f);
+	}
+
+	return out - output;
+}
+
+} // End of anonymous namespace
+
+uint32 getADPCMBlockSamples(ADPCMType type, uint32 blockSize, int channels) {
+	switch (type) {
+	case kADPCMMSIma:
+		if (blockSize < 4 * (uint32)channels)
+			return 0;
+		return (blockSize - 4 * channels) / (4 * channels) * 8 * channels;
+	case kADPCMMS:
+		if (blockSize < 7 * (uint32)channels)
+			return 0;
+		return 2 * channels + (blockSize - 7 * channels) * 2;
+	default:
+		return 0;
+	}
+}
+
+int decodeADPCMBlock(ADPCMType type, const byte *block, uint32 blockSize, int channels, int16 *output) {
+	assert(channels == 1 || channels == 2);
+
+	switch (type) {
+	case kADPCMMSIma:
+		return decodeMSImaBlock(block, blockSize, channels, output);
+	case kADPCMMS:
+		return decodeMSBlock(block, blockSize, channels, output);
+	default:
+		return -1;
+	}
 }
 
 
@@ -445,15 +536,7 @@ const int16 Ima_ADPCMStream::_imaTable[89] = {
 };
 
 int16 Ima_ADPCMStream::decodeIMA(byte code, int channel) {
-	int32 E = (2 * (code & 0x7) + 1) * _imaTable[_status.ima_ch[channel].stepIndex] / 8;
-	int32 diff = (code & 0x08) ? -E : E;
-	int32 samp = CLIP<int32>(_status.ima_ch[channel].last + diff, -32768, 32767);
-
-	_status.ima_ch[channel].last = samp;
-	_status.ima_ch[channel].stepIndex += _stepAdjustTable[code];
-	_status.ima_ch[channel].stepIndex = CLIP<int32>(_status.ima_ch[channel].stepIndex, 0, ARRAYSIZE(_imaTable) - 1);
-
-	return samp;
+	return decodeIMANibble(_status.ima_ch[channel].last, _status.ima_ch[channel].stepIndex, code);
 }
 
 SeekableAudioStream *makeADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, ADPCMType type, int rate, int channels, uint32 blockAlign) {
@@ -103,6 +103,34 @@ PacketizedAudioStream *makePacketizedADPCMStream(
 	int channels,
 	uint32 blockAlign = 0);
 
+/**
+ * Get the number of samples (of all channels together) decodeADPCMBlock()
+ * produces for a block of the given size.
+ *
+ * @param type              the compression type used
+ * @param blockSize         the size of the block in bytes, including its header
+ * @param channels          the number of channels
+ * @return the number of samples, or 0 if the type is not block based
+ */
+uint32 getADPCMBlockSamples(ADPCMType type, uint32 blockSize, int channels);
+
+/**
+ * Decode one complete block of ADPCM data in a single call, without the
+ * overhead of going through an AudioStream. Only the block based types,
+ * kADPCMMSIma and kADPCMMS, are supported. Stereo output is interleaved.
+ *
+ * A short last block is allowed; data after the last complete group of
+ * samples is ignored.
+ *
+ * @param type              the compression type used
+ * @param block             the block data, including its header
+ * @param blockSize         the size of the block in bytes
+ * @param channels          the number of channels
+ * @param output            receives getADPCMBlockSamples() samples
+ * @return the number of samples written, or -1 if the type is not supported
+ */
+int decodeADPCMBlock(ADPCMType type, const byte *block, uint32 blockSize, int channels, int16 *output);
+
 } // End of namespace Audio
 
 #endif
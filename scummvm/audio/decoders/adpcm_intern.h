@@ -32,6 +32,7 @@
 #define AUDIO_ADPCM_INTERN_H
 
 #include "audio/audiostream.h"
+#include "audio/decoders/adpcm.h"
 #include "common/endian.h"
 #include "common/ptr.h"
 #include "common/stream.h"
@@ -153,76 +154,53 @@ public:
 
 };
 
-class MSIma_ADPCMStream : public Ima_ADPCMStream {
+/**
+ * Base class for the ADPCM variants made up of self-contained blocks. Each
+ * block is read with a single read() call and decoded in one go by
+ * decodeADPCMBlock(), instead of fetching and decoding one nibble at a time.
+ */
+class BlockADPCMStream : public ADPCMStream {
 public:
-	MSIma_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
-		: Ima_ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {
-
-		if (blockAlign == 0)
-			error("MSIma_ADPCMStream(): blockAlign isn't specified");
+	BlockADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign, ADPCMType type);
+	~BlockADPCMStream();
 
-		if (blockAlign % (_channels * 4))
-			error("MSIma_ADPCMStream(): invalid blockAlign");
-
-		_samplesLeft[0] = 0;
-		_samplesLeft[1] = 0;
-	}
+	virtual bool endOfData() const { return _samplePos == _sampleCount && ADPCMStream::endOfData(); }
 
 	virtual int readBuffer(int16 *buffer, const int numSamples);
 
-	void reset() {
-		Ima_ADPCMStream::reset();
-		_samplesLeft[0] = 0;
-		_samplesLeft[1] = 0;
-	}
+protected:
+	virtual void reset();
 
 private:
-	int16 _buffer[2][8];
-	int _samplesLeft[2];
+	bool readBlock();
+
+	const ADPCMType _type;
+	byte *_blockData;
+	int16 *_blockSamples;
+	uint32 _sampleCount;
+	uint32 _samplePos;
 };
 
-class MS_ADPCMStream : public ADPCMStream {
-protected:
-	struct ADPCMChannelStatus {
-		byte predictor;
-		int16 delta;
-		int16 coeff1;
-		int16 coeff2;
-		int16 sample1;
-		int16 sample2;
-	};
-
-	struct {
-		// MS ADPCM
-		ADPCMChannelStatus ch[2];
-	} _status;
+class MSIma_ADPCMStream : public BlockADPCMStream {
+public:
+	MSIma_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
+		: BlockADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign, kADPCMMSIma) {
 
-	void reset() {
-		ADPCMStream::reset();
-		memset(&_status, 0, sizeof(_status));
+		if (blockAlign == 0)
+			error("MSIma_ADPCMStream(): blockAlign isn't specified");
+
+		if (blockAlign % (_channels * 4))
+			error("MSIma_ADPCMStream(): invalid blockAlign");
 	}
+};
 
+class MS_ADPCMStream : public BlockADPCMStream {
 public:
 	MS_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
-		: ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {
+		: BlockADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign, kADPCMMS) {
 		if (blockAlign == 0)
 			error("MS_ADPCMStream(): blockAlign isn't specified for MS ADPCM");
-		memset(&_status, 0, sizeof(_status));
-		_decodedSampleCount = 0;
-		_decodedSampleIndex = 0;
 	}
-
-	virtual bool endOfData() const { return (_stream->eos() || _stream->pos() >= _endpos) && (_decodedSampleCount == 0); }
-
-	virtual int readBuffer(int16 *buffer, const int numSamples);
-
-protected:
-	int16 decodeMS(ADPCMChannelStatus *c, byte);
-
-private:
-	uint8 _decodedSampleCount;
-	uint8 _decodedSampleIndex;
-	int16 _decodedSamples[4];
 };
 
 // Duck DK3 IMA ADPCM Decoder
@@ -24,6 +24,7 @@
 
 #ifdef USE_MAD
 
+#include "common/array.h"
 #include "common/debug.h"
 #include "common/mutex.h"
 #include "common/ptr.h"
@@ -76,6 +77,9 @@ protected:
 	uint _posInFrame;
 	State _state;
 
+	/** Input position of the first byte in _buf */
+	uint32 _bufOffset;
+
 	mad_timer_t _curTime;
 
 	mad_stream _stream;
@@ -108,6 +112,26 @@ protected:
 	Timestamp _length;
 
 private:
+	/**
+	 * A frame the decoder can restart at: its start time and input position.
+	 * One is recorded every kSeekPointInterval frames while the constructor
+	 * scans the stream for its length, so seeking only has to skip a few
+	 * frame headers instead of all of them from the start.
+	 */
+	struct SeekPoint {
+		mad_timer_t time;
+		uint32 offset;
+	};
+
+	enum {
+		kSeekPointInterval = 16,
+		kPrimeFrames = 8 // Enough to refill the largest bit reservoir at low bitrates
+	};
+
+	Common::Array<SeekPoint> _seekPoints;
+
+	void restartAt(const SeekPoint &point);
+
 	static Common::SeekableReadStream *skipID3(Common::SeekableReadStream *stream, DisposeAfterUse::Flag dispose);
 };
 
@@ -136,6 +160,7 @@ private:
 BaseMP3Stream::BaseMP3Stream() :
 	_posInFrame(0),
 	_state(MP3_STATE_INIT),
+	_bufOffset(0),
 	_curTime(mad_timer_zero) {
 
 	// The MAD_BUFFER_GUARD must always contain zeros (the reason
@@ -207,6 +232,7 @@ void BaseMP3Stream::readMP3Data(Common::ReadStream &stream) {
 		// and hence the data regions we copy from and to may overlap.
 		remaining = _stream.bufend - _stream.next_frame;
 		assert(remaining < BUFFER_SIZE);	// Paranoia check
+		_bufOffset += _stream.next_frame - _buf;
 		memmove(_buf, _stream.next_frame, remaining);
 	}
 
@@ -337,10 +363,21 @@ MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag
 	_channels = MAD_NCHANNELS(&_frame.header);
 	_rate = _frame.header.samplerate;
 
-	// Calculate the length of the stream
-	while (_state != MP3_STATE_EOS)
+	// Calculate the length of the stream, remembering where frames start
+	// along the way
+	uint32 frames = 0;
+	while (_state != MP3_STATE_EOS) {
+		const mad_timer_t frameStart = _curTime;
 		readHeader(*_inStream);
 
+		if (_state != MP3_STATE_EOS && (frames++ % kSeekPointInterval) == 0) {
+			SeekPoint point;
+			point.time = frameStart;
+			point.offset = _bufOffset + (_stream.this_frame - _buf);
+			_seekPoints.push_back(point);
+		}
+	}
+
 	// To rule out any invalid sample rate to be encountered here, say in case the
 	// MP3 stream is invalid, we just check the MAD error code here.
 	// We need to assure this, since else we might trigger an assertion in Timestamp
@@ -355,6 +392,7 @@ MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag
 	// Reinit stream
 	_state = MP3_STATE_INIT;
 	_inStream->seek(0);
+	_bufOffset = 0;
 
 	// Decode the first chunk of data to set up the stream again.
 	decodeMP3Data(*_inStream);
@@ -377,17 +415,75 @@ bool MP3Stream::seek(const Timestamp &where) {
 	mad_timer_t destination;
 	mad_timer_set(&destination, time / 1000, time % 1000, 1000);
 
-	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0) {
+	// Find the last seek point at or before the destination
+	uint lo = 0, hi = _seekPoints.size();
+	while (lo < hi) {
+		const uint mid = (lo + hi) / 2;
+		if (mad_timer_compare(_seekPoints[mid].time, destination) <= 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	// Restart one seek point earlier, so that there are frames ahead of the
+	// destination to prime the decoder with
+	if (lo > 0) {
+		restartAt(_seekPoints[lo > 1 ? lo - 2 : 0]);
+	} else {
 		_inStream->seek(0);
+		_bufOffset = 0;
 		initStream(*_inStream);
 	}
 
-	while (mad_timer_compare(destination, _curTime) > 0 && _state != MP3_STATE_EOS)
+	// Skip the headers of the frames up to the one containing the
+	// destination, remembering where the last few of them start
+	SeekPoint frames[kPrimeFrames + 1];
+	uint frameCount = 0;
+	while (mad_timer_compare(destination, _curTime) >= 0 && _state != MP3_STATE_EOS) {
+		SeekPoint frame;
+		frame.time = _curTime;
 		readHeader(*_inStream);
+		frame.offset = _bufOffset + (_stream.this_frame - _buf);
+		frames[frameCount++ % (kPrimeFrames + 1)] = frame;
+	}
 
-	decodeMP3Data(*_inStream);
+	if (_state == MP3_STATE_EOS)
+		return false;
+
+	// Layer III frames may take part of their data from the frames before
+	// them (the bit reservoir), and the synthesis overlaps with the previous
+	// frame. Header skipping sets up neither, so fully decode the preceding
+	// frames and throw their output away.
+	const SeekPoint target = frames[(frameCount - 1) % (kPrimeFrames + 1)];
+	restartAt(frames[frameCount > kPrimeFrames ? frameCount % (kPrimeFrames + 1) : 0]);
+
+	do {
+		decodeMP3Data(*_inStream);
+	} while (_state != MP3_STATE_EOS && _bufOffset + (_stream.this_frame - _buf) < target.offset);
+
+	if (_state == MP3_STATE_EOS)
+		return false;
+
+	// Skip the part of the frame before the destination, unless the frame
+	// was bad and decoding went on to a later one, whose timing is unknown
+	if (_bufOffset + (_stream.this_frame - _buf) == target.offset) {
+		_curTime = target.time;
+		mad_timer_add(&_curTime, _frame.header.duration);
+
+		mad_timer_t offset = target.time;
+		mad_timer_negate(&offset);
+		mad_timer_add(&offset, destination);
+		_posInFrame = MIN<uint>(mad_timer_count(offset, (mad_units)_rate), _synth.pcm.length);
+	}
+
+	return true;
+}
 
-	return (_state != MP3_STATE_EOS);
+void MP3Stream::restartAt(const SeekPoint &point) {
+	_inStream->seek(point.offset);
+	_bufOffset = point.offset;
+	initStream(*_inStream);
+	_curTime = point.time;
 }
 
 Common::SeekableReadStream *MP3Stream::skipID3(Common::SeekableReadStream *stream, DisposeAfterUse::Flag dispose) {
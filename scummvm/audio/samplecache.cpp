@@ -0,0 +1,224 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/samplecache.h"
+#include "audio/audiostream.h"
+#include "audio/decoders/raw.h"
+
+#include "common/debug.h"
+#include "common/hash-str.h"
+#include "common/memstream.h"
+#include "common/mutex.h"
+
+namespace Audio {
+
+/**
+ * Decoded PCM data shared between the cache and the streams playing it.
+ * Streams may be destroyed by the mixer thread, so the reference count is
+ * protected by a mutex.
+ */
+class SampleBuffer {
+public:
+	SampleBuffer(byte *data, uint32 size, int rate, bool stereo) :
+		_refs(1), _data(data), _size(size), _rate(rate), _stereo(stereo) {}
+
+	void incRef() {
+		Common::StackLock lock(_mutex);
+		++_refs;
+	}
+
+	void decRef() {
+		bool last;
+		{
+			Common::StackLock lock(_mutex);
+			last = (--_refs == 0);
+		}
+
+		if (last)
+			delete this;
+	}
+
+	SeekableAudioStream *makeStream();
+
+	uint32 getSize() const { return _size; }
+
+private:
+	~SampleBuffer() { free(_data); }
+
+	Common::Mutex _mutex;
+	int _refs;
+
+	byte *_data;
+	uint32 _size;
+	int _rate;
+	bool _stereo;
+
+	friend class SampleBufferStream;
+};
+
+/**
+ * Read stream over a SampleBuffer, holding a reference to it.
+ */
+class SampleBufferStream : public Common::MemoryReadStream {
+public:
+	SampleBufferStream(SampleBuffer *buffer) :
+		Common::MemoryReadStream(buffer->_data, buffer->_size, DisposeAfterUse::NO), _buffer(buffer) {
+		_buffer->incRef();
+	}
+
+	~SampleBufferStream() {
+		_buffer->decRef();
+	}
+
+private:
+	SampleBuffer *_buffer;
+};
+
+SeekableAudioStream *SampleBuffer::makeStream() {
+	byte flags = FLAG_16BITS;
+#ifdef SCUMM_LITTLE_ENDIAN
+	flags |= FLAG_LITTLE_ENDIAN;
+#endif
+	if (_stereo)
+		flags |= FLAG_STEREO;
+
+	return makeRawStream(new SampleBufferStream(this), _rate, flags, DisposeAfterUse::YES);
+}
+
+uint SampleCacheKey_Hash::operator()(const SampleCacheKey &key) const {
+	return Common::hashit_lower(key.name) ^ (key.offset * 2654435761U) ^ key.codec;
+}
+
+SampleCache::SampleCache(uint32 budget) :
+	_budget(budget), _size(0), _useCounter(0), _hits(0), _misses(0) {
+}
+
+SampleCache::~SampleCache() {
+	if (_hits || _misses)
+		debug(2, "SampleCache: %u hits, %u misses, %u bytes cached", _hits, _misses, _size);
+
+	clear();
+}
+
+SeekableAudioStream *SampleCache::find(const SampleCacheKey &key) {
+	EntryMap::iterator i = _entries.find(key);
+	if (i == _entries.end()) {
+		++_misses;
+		return 0;
+	}
+
+	++_hits;
+	i->_value.lastUsed = ++_useCounter;
+	return i->_value.buffer->makeStream();
+}
+
+SeekableAudioStream *SampleCache::add(const SampleCacheKey &key, SeekableAudioStream *stream) {
+	if (!stream)
+		return 0;
+
+	// Only cache samples taking up a fraction of the budget, so a single
+	// long sample does not flush all the short ones
+	const int channels = stream->isStereo() ? 2 : 1;
+	const int frames = stream->getLength().convertToFramerate(stream->getRate()).totalNumberOfFrames();
+	const uint32 maxSize = _budget / 4;
+	if (frames <= 0 || (uint32)frames > maxSize / (2 * channels))
+		return stream;
+
+	uint32 numSamples = frames * channels;
+	int16 *data = (int16 *)malloc(numSamples * 2);
+	if (!data)
+		return stream;
+
+	// The length reported by some decoders is only an estimate; read all
+	// there is, as long as it stays below the limit
+	uint32 decoded = 0;
+	while (!stream->endOfData()) {
+		if (decoded == numSamples) {
+			if (numSamples * 2 >= maxSize) {
+				free(data);
+				stream->rewind();
+				return stream;
+			}
+
+			numSamples = MIN<uint32>(numSamples * 2, maxSize / 2) / channels * channels;
+			int16 *newData = (int16 *)realloc(data, numSamples * 2);
+			if (!newData) {
+				free(data);
+				stream->rewind();
+				return stream;
+			}
+			data = newData;
+		}
+
+		const int read = stream->readBuffer(data + decoded, numSamples - decoded);
+		if (read <= 0)
+			break;
+		decoded += read;
+	}
+
+	SampleBuffer *buffer = new SampleBuffer((byte *)data, decoded * 2, stream->getRate(), channels == 2);
+	delete stream;
+
+	EntryMap::iterator old = _entries.find(key);
+	if (old != _entries.end()) {
+		_size -= old->_value.buffer->getSize();
+		old->_value.buffer->decRef();
+		_entries.erase(old);
+	}
+
+	while (_size + buffer->getSize() > _budget && evictOldest())
+		;
+
+	Entry entry;
+	entry.buffer = buffer;
+	entry.lastUsed = ++_useCounter;
+	_entries[key] = entry;
+	_size += buffer->getSize();
+
+	return buffer->makeStream();
+}
+
+void SampleCache::clear() {
+	for (EntryMap::iterator i = _entries.begin(); i != _entries.end(); ++i)
+		i->_value.buffer->decRef();
+
+	_entries.clear();
+	_size = 0;
+}
+
+bool SampleCache::evictOldest() {
+	EntryMap::iterator oldest = _entries.end();
+	for (EntryMap::iterator i = _entries.begin(); i != _entries.end(); ++i) {
+		if (oldest == _entries.end() || i->_value.lastUsed < oldest->_value.lastUsed)
+			oldest = i;
+	}
+
+	if (oldest == _entries.end())
+		return false;
+
+	_size -= oldest->_value.buffer->getSize();
+	oldest->_value.buffer->decRef();
+	_entries.erase(oldest);
+	return true;
+}
+
+} // End of namespace Audio
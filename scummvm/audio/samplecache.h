@@ -0,0 +1,127 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_SAMPLECACHE_H
+#define AUDIO_SAMPLECACHE_H
+
+#include "common/scummsys.h"
+#include "common/hashmap.h"
+#include "common/noncopyable.h"
+#include "common/str.h"
+
+namespace Audio {
+
+class SeekableAudioStream;
+class SampleBuffer;
+
+/**
+ * Identifies a cached sample: the archive member it was read from, its
+ * offset inside that member and the codec used to decode it. The codec is
+ * an arbitrary tag chosen by the engine, e.g. MKTAG('V','O','C',' ').
+ */
+struct SampleCacheKey {
+	Common::String name;
+	uint32 offset;
+	uint32 codec;
+
+	SampleCacheKey(const Common::String &n, uint32 o = 0, uint32 c = 0) : name(n), offset(o), codec(c) {}
+
+	bool operator==(const SampleCacheKey &other) const {
+		return offset == other.offset && codec == other.codec && name.equalsIgnoreCase(other.name);
+	}
+};
+
+struct SampleCacheKey_Hash {
+	uint operator()(const SampleCacheKey &key) const;
+};
+
+/**
+ * Cache of fully decoded samples, meant for short sound effects which are
+ * played over and over again. Instead of creating a new decoder, parsing
+ * the headers and decoding the compressed data on every playback, the PCM
+ * data is decoded once and every later request is served by a RawStream
+ * reading straight from the cached buffer.
+ *
+ * The decoded data is reference counted: streams handed out by the cache
+ * stay valid when their entry is evicted or the cache is destroyed.
+ */
+class SampleCache : Common::NonCopyable {
+public:
+	enum {
+		kDefaultBudget = 2 * 1024 * 1024
+	};
+
+	/**
+	 * @param budget    maximum total size of the decoded data in bytes.
+	 */
+	SampleCache(uint32 budget = kDefaultBudget);
+	~SampleCache();
+
+	/**
+	 * Look up a sample.
+	 *
+	 * @return a new stream playing the cached sample, or 0 if it is not
+	 *         cached. The caller takes ownership of the stream.
+	 */
+	SeekableAudioStream *find(const SampleCacheKey &key);
+
+	/**
+	 * Decode a sample and add it to the cache. Samples too large to be
+	 * cached, or of unknown length, are not decoded and the passed stream is
+	 * returned unchanged.
+	 *
+	 * @param key       the key to store the sample under.
+	 * @param stream    the decoder for the sample. The cache takes ownership.
+	 * @return a stream playing the sample. The caller takes ownership.
+	 */
+	SeekableAudioStream *add(const SampleCacheKey &key, SeekableAudioStream *stream);
+
+	/**
+	 * Drop all cached samples. Streams still playing are not affected.
+	 */
+	void clear();
+
+	uint32 getSize() const { return _size; }
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+
+private:
+	struct Entry {
+		SampleBuffer *buffer;
+		uint32 lastUsed;
+	};
+
+	typedef Common::HashMap<SampleCacheKey, Entry, SampleCacheKey_Hash> EntryMap;
+	EntryMap _entries;
+
+	uint32 _budget;
+	uint32 _size;
+	uint32 _useCounter;
+	uint32 _hits;
+	uint32 _misses;
+
+	bool evictOldest();
+};
+
+} // End of namespace Audio
+
+#endif
@@ -201,6 +201,15 @@ int MidiDriver_MT32::open() {
 
 	pcmFile.close();
 
+	// Performance mode skips the emulation of the analog output stage, at
+	// the cost of some accuracy. This keeps the mixer callback from
+	// underrunning on slow devices. No sample rate converter is involved, as
+	// the output is mixed at the synth's own rate.
+	if (ConfMan.getBool("mt32_performance_mode")) {
+		debug(4, "MT32Emu: Using performance mode");
+		_service.setAnalogOutputMode(MT32Emu::AnalogOutputMode_DIGITAL_ONLY);
+	}
+
 	if (_service.openSynth() != MT32EMU_RC_OK)
 		return MERR_DEVICE_NOT_AVAILABLE;
 
@@ -436,6 +436,8 @@ static const VolumeHandler VolumeHandlerTable[5] = {
 };
 
 INLINE Bitu Operator::ForwardVolume() {
+	if ( envelopeHeld )
+		return heldLevel;
 	return currentLevel + (this->*volHandler)();
 }
 
@@ -541,6 +543,17 @@ INLINE void Operator::Prepare( const Chip* chip )  {
 		add = ( add ^ neg ) - neg;
 		waveCurrent += add;
 	}
+	//Off and sustaining envelopes only move on register writes, which never
+	//happen inside a block, so skip the volume handler for the whole block
+	if ( state == OFF ) {
+		envelopeHeld = true;
+		heldLevel = currentLevel + ENV_MAX;
+	} else if ( state == SUSTAIN && ( reg20 & MASK_SUSTAIN ) ) {
+		envelopeHeld = true;
+		heldLevel = currentLevel + volume;
+	} else {
+		envelopeHeld = false;
+	}
 }
 
 void Operator::KeyOn( Bit8u mask ) {
@@ -616,6 +629,8 @@ Operator::Operator() {
 	totalLevel = ENV_MAX;
 	volume = ENV_MAX;
 	releaseAdd = 0;
+	heldLevel = ENV_MAX;
+	envelopeHeld = false;
 }
 
 /*
@@ -1224,9 +1239,7 @@ void Chip::GenerateBlock2( Bitu total, Bit32s* output ) {
 	while ( total > 0 ) {
 		Bit32u samples = ForwardLFO( total );
 		memset(output, 0, sizeof(Bit32s) * samples);
-		int count = 0;
 		for( Channel* ch = chan; ch < chan + 9; ) {
-			count++;
 			ch = (ch->*(ch->synthHandler))( this, samples, output );
 		}
 		total -= samples;
@@ -1238,9 +1251,7 @@ void Chip::GenerateBlock3( Bitu total, Bit32s* output  ) {
 	while ( total > 0 ) {
 		Bit32u samples = ForwardLFO( total );
 		memset(output, 0, sizeof(Bit32s) * samples * 2);
-		int count = 0;
 		for( Channel* ch = chan; ch < chan + 18; ) {
-			count++;
 			ch = (ch->*(ch->synthHandler))( this, samples, output );
 		}
 		total -= samples;
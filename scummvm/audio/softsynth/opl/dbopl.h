@@ -129,6 +129,7 @@ public:
 	Bit32s totalLevel;			//totalLevel is added to every generated volume
 	Bit32u currentLevel;		//totalLevel + tremolo
 	Bit32s volume;				//The currently active volume
+	Bitu heldLevel;				//currentLevel + volume while the envelope is held for a block
 
 	Bit32u attackAdd;			//Timers for the different states of the envelope
 	Bit32u decayAdd;
@@ -147,6 +148,8 @@ public:
 	Bit8u vibStrength;
 	//Keep track of the calculated KSR so we can check for changes
 	Bit8u ksr;
+	//Envelope can't change until the next register write, use heldLevel
+	bool envelopeHeld;
 private:
 	void SetState( Bit8u s );
 	void UpdateAttack( const Chip* chip );
@@ -1478,7 +1478,7 @@ byte OPL::read(int port) {
 }
 
 void OPL::generateSamples(int16*buffer, int length) {
-	OPL3_GenerateStream(&chip, (Bit16s*)buffer, (Bit16u)length / 2);
+	OPL3_GenerateStream(&chip, (Bit16s*)buffer, (Bit32u)length / 2);
 }
 
 }
@@ -25,6 +25,7 @@
 #if !defined(DISABLE_DEFAULT_EVENTMANAGER)
 
 #include "common/system.h"
+#include "common/debug.h"
 #include "common/config-manager.h"
 #include "common/translation.h"
 #include "backends/events/default/default-events.h"
@@ -36,6 +37,10 @@
 #include "gui/message.h"
 
 DefaultEventManager::DefaultEventManager(Common::EventSource *boss) :
+	_statsTime(0),
+	_eventsReceived(0),
+	_eventsCoalesced(0),
+	_maxQueueDepth(0),
 	_buttonState(0),
 	_modifierState(0),
 	_shouldQuit(false),
@@ -84,6 +89,65 @@ void DefaultEventManager::init() {
 #endif
 }
 
+bool DefaultEventManager::notifyEvent(const Common::Event &ev) {
+	++_eventsReceived;
+
+	// If the engine has not yet consumed the previous mouse motion, only the
+	// latest position matters: overwrite the pending event instead of adding
+	// another one. Motion is never merged across other events, so clicks keep
+	// the position they happened at.
+	if (ev.type == Common::EVENT_MOUSEMOVE) {
+		Common::Event *last = nullptr;
+		if (!_eventOverflow.empty())
+			last = &_eventOverflow.back();
+		else if (!_eventQueue.empty())
+			last = &_eventQueue.back();
+
+		if (last && last->type == Common::EVENT_MOUSEMOVE) {
+			*last = ev;
+			++_eventsCoalesced;
+			return true;
+		}
+	}
+
+	queueEvent(ev);
+	return true;
+}
+
+void DefaultEventManager::queueEvent(const Common::Event &ev) {
+	if (_eventOverflow.empty() && !_eventQueue.full())
+		_eventQueue.push(ev);
+	else
+		_eventOverflow.push(ev);
+
+	uint depth = _eventQueue.size() + _eventOverflow.size();
+	if (depth > _maxQueueDepth)
+		_maxQueueDepth = depth;
+}
+
+Common::Event DefaultEventManager::dequeueEvent() {
+	Common::Event event = _eventQueue.pop();
+	if (!_eventOverflow.empty())
+		_eventQueue.push(_eventOverflow.pop());
+	return event;
+}
+
+void DefaultEventManager::updateStats() {
+	uint32 time = g_system->getMillis(true);
+	if (time - _statsTime < 1000)
+		return;
+
+	if (_eventsReceived) {
+		debug(9, "Events: %u received, %u coalesced, max queue depth %u in %u ms",
+		      _eventsReceived, _eventsCoalesced, _maxQueueDepth, time - _statsTime);
+	}
+
+	_statsTime = time;
+	_eventsReceived = 0;
+	_eventsCoalesced = 0;
+	_maxQueueDepth = _eventQueue.size() + _eventOverflow.size();
+}
+
 bool DefaultEventManager::pollEvent(Common::Event &event) {
 	_dispatcher.dispatch();
 
@@ -91,11 +155,14 @@ bool DefaultEventManager::pollEvent(Common::Event &event) {
 		handleKeyRepeat();
 	}
 
-	if (_eventQueue.empty()) {
+	if (gDebugLevel >= 9)
+		updateStats();
+
+	if (eventQueueEmpty()) {
 		return false;
 	}
 
-	event = _eventQueue.pop();
+	event = dequeueEvent();
 	bool forwardEvent = true;
 
 	switch (event.type) {
@@ -229,9 +296,9 @@ bool DefaultEventManager::pollEvent(Common::Event &event) {
 void DefaultEventManager::handleKeyRepeat() {
 	uint32 time = g_system->getMillis(true);
 
-	if (!_eventQueue.empty()) {
+	if (!eventQueueEmpty()) {
 		// Peek in the event queue
-		const Common::Event &nextEvent = _eventQueue.front();
+		const Common::Event &nextEvent = peekEvent();
 
 		switch (nextEvent.type) {
 		case Common::EVENT_KEYDOWN:
@@ -260,7 +327,7 @@ void DefaultEventManager::handleKeyRepeat() {
 			repeatEvent.kbd = _currentKeyDown;
 			_keyRepeatTime = time + kKeyRepeatSustainDelay;
 
-			_eventQueue.push(repeatEvent);
+			queueEvent(repeatEvent);
 		}
 	}
 }
@@ -277,9 +344,11 @@ void DefaultEventManager::pushEvent(const Common::Event &event) {
 void DefaultEventManager::purgeMouseEvents() {
 	_dispatcher.dispatch();
 
-	Common::Queue<Common::Event> filteredQueue;
-	while (!_eventQueue.empty()) {
-		Common::Event event = _eventQueue.pop();
+	// Filter the queued events in place: each event is popped once and
+	// non-mouse events are queued again behind the ones still pending.
+	uint count = _eventQueue.size() + _eventOverflow.size();
+	while (count--) {
+		Common::Event event = dequeueEvent();
 		switch (event.type) {
 		// Update button state even when purging events to avoid desynchronisation with real button state
 		case Common::EVENT_LBUTTONDOWN:
@@ -310,11 +379,10 @@ void DefaultEventManager::purgeMouseEvents() {
 			// do nothing
 			break;
 		default:
-			filteredQueue.push(event);
+			queueEvent(event);
 			break;
 		}
 	}
-	_eventQueue = filteredQueue;
 }
 
 #endif // !defined(DISABLE_DEFAULT_EVENTMANAGER)
@@ -48,11 +48,32 @@ class DefaultEventManager : public Common::EventManager, Common::EventObserver {
 
 	Common::ArtificialEventSource _artificialEventSource;
 
-	Common::Queue<Common::Event> _eventQueue;
-	bool notifyEvent(const Common::Event &ev) override {
-		_eventQueue.push(ev);
-		return true;
-	}
+	enum {
+		kEventQueueSize = 128
+	};
+
+	/**
+	 * Events waiting to be polled. The ring buffer avoids a heap allocation
+	 * per event; only when the engine stops polling for a long time do
+	 * further events spill into _eventOverflow, so no input is ever lost.
+	 */
+	Common::FixedQueue<Common::Event, kEventQueueSize> _eventQueue;
+	Common::Queue<Common::Event> _eventOverflow;
+
+	bool notifyEvent(const Common::Event &ev) override;
+
+	bool eventQueueEmpty() const { return _eventQueue.empty(); }
+	const Common::Event &peekEvent() const { return _eventQueue.front(); }
+	void queueEvent(const Common::Event &ev);
+	Common::Event dequeueEvent();
+
+	// Event statistics, reported once per second at debug level 9
+	uint32 _statsTime;
+	uint32 _eventsReceived;
+	uint32 _eventsCoalesced;
+	uint _maxQueueDepth;
+
+	void updateStats();
 
 	Common::Point _mousePos;
 	int _buttonState;
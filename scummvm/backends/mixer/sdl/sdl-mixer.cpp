@@ -41,15 +41,35 @@
 SdlMixerManager::SdlMixerManager()
 	:
 	_mixer(0),
-	_audioSuspended(false) {
+	_audioSuspended(false),
+	_underruns(0),
+	_worstMixTime(0) {
 
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	_mixThread = 0;
+	_mixSem = 0;
+	_ring = 0;
+	_ringSize = _ringChunk = 0;
+	SDL_AtomicSet(&_mixThreadQuit, 0);
+	SDL_AtomicSet(&_mixAhead, 0);
+	SDL_AtomicSet(&_ringRead, 0);
+	SDL_AtomicSet(&_ringWrite, 0);
+#endif
 }
 
 SdlMixerManager::~SdlMixerManager() {
 	_mixer->setReady(false);
 
+	// Close the device first; this waits for a running callback to return,
+	// so it can no longer be reading the ring freed below
 	SDL_CloseAudio();
 
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	stopMixThread();
+#endif
+
+	debug(1, "SDL mixer: %u underruns, worst mix time %u us", _underruns, _worstMixTime);
+
 	delete _mixer;
 }
 
@@ -122,6 +142,17 @@ void SdlMixerManager::init() {
 	assert(_mixer);
 	_mixer->setReady(true);
 
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	// Optionally render audio ahead of playback on a separate thread; like
+	// audio_buffer_size this is only settable in the config file
+	const char *const appDomain = Common::ConfigManager::kApplicationDomain;
+	if (ConfMan.hasKey("audio_mix_ahead", appDomain)) {
+		int leadTime = ConfMan.getInt("audio_mix_ahead", appDomain);
+		if (leadTime > 0)
+			startMixThread(MIN(leadTime, 1000));
+	}
+#endif
+
 	startAudio();
 }
 
@@ -195,9 +226,163 @@ void SdlMixerManager::startAudio() {
 
 void SdlMixerManager::callbackHandler(byte *samples, int len) {
 	assert(_mixer);
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	if (SDL_AtomicGet(&_mixAhead)) {
+		drainRing(samples, len);
+		return;
+	}
+#endif
+	uint32 mixTime = mixTimed(samples, len);
+
+	// Without a ring to fall back on, a mix slower than the buffer it fills
+	// means the device ran dry
+	const uint32 frames = len / (2 * _obtained.channels);
+	if ((uint64)mixTime * _obtained.freq > (uint64)frames * 1000000)
+		++_underruns;
+}
+
+uint32 SdlMixerManager::mixTimed(byte *samples, int len) {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	const Uint64 start = SDL_GetPerformanceCounter();
+	_mixer->mixCallback(samples, len);
+	const uint32 mixTime = (uint32)((SDL_GetPerformanceCounter() - start) * 1000000 / SDL_GetPerformanceFrequency());
+#else
+	const uint32 start = SDL_GetTicks();
 	_mixer->mixCallback(samples, len);
+	const uint32 mixTime = (SDL_GetTicks() - start) * 1000;
+#endif
+
+	if (mixTime > _worstMixTime)
+		_worstMixTime = mixTime;
+	return mixTime;
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+void SdlMixerManager::startMixThread(uint32 leadTime) {
+	// Mix in chunks of one device buffer, so that the chunks tile the ring
+	// and never straddle its end
+	_ringChunk = _obtained.samples * 2 * _obtained.channels;
+	const uint32 frameSize = 2 * _obtained.channels;
+	const uint32 leadBytes = (uint32)((uint64)_obtained.freq * leadTime / 1000) * frameSize;
+
+	// Keep the lead time queued on top of the buffer the callback is about to
+	// take. The device buffer size need not be a power of two, so the ring is
+	// a whole number of chunks and the positions are wrapped explicitly.
+	_ringSize = (leadBytes + _ringChunk - 1) / _ringChunk * _ringChunk + _ringChunk;
+
+	_ring = new byte[_ringSize];
+	SDL_AtomicSet(&_ringRead, 0);
+	SDL_AtomicSet(&_mixThreadQuit, 0);
+
+	// Fill the lead before playback starts, so the first callbacks do not
+	// count as underruns
+	uint32 write = 0;
+	while (write < _ringSize) {
+		mixTimed(_ring + write, _ringChunk);
+		write += _ringChunk;
+	}
+	SDL_AtomicSet(&_ringWrite, (int)write);
+
+	_mixSem = SDL_CreateSemaphore(0);
+	if (_mixSem)
+		_mixThread = SDL_CreateThread(mixThreadEntry, "ScummVM mixer", this);
+
+	if (!_mixThread) {
+		warning("Could not start audio mixing thread: %s", SDL_GetError());
+		stopMixThread();
+		return;
+	}
+
+	SDL_AtomicSet(&_mixAhead, 1);
+	debug(1, "Mixing audio %u ms ahead in a %u byte ring", leadTime, _ringSize);
 }
 
+void SdlMixerManager::stopMixThread() {
+	// Switch the callback back to direct mixing before the ring goes away.
+	// Holding the audio lock makes sure it is not in drainRing() meanwhile.
+	SDL_LockAudio();
+	SDL_AtomicSet(&_mixAhead, 0);
+	SDL_UnlockAudio();
+
+	if (_mixThread) {
+		SDL_AtomicSet(&_mixThreadQuit, 1);
+		SDL_SemPost(_mixSem);
+		SDL_WaitThread(_mixThread, NULL);
+		_mixThread = 0;
+	}
+
+	if (_mixSem) {
+		SDL_DestroySemaphore(_mixSem);
+		_mixSem = 0;
+	}
+
+	delete[] _ring;
+	_ring = 0;
+}
+
+uint32 SdlMixerManager::ringFill(uint32 read, uint32 write) const {
+	// The positions run over twice the ring size, so that a full ring can be
+	// told apart from an empty one
+	return (write + 2 * _ringSize - read) % (2 * _ringSize);
+}
+
+void SdlMixerManager::flushRing() {
+	// Drop everything queued; the mix thread refills the ring from the
+	// mixer's current state
+	SDL_AtomicSet(&_ringRead, SDL_AtomicGet(&_ringWrite));
+	SDL_SemPost(_mixSem);
+}
+
+void SdlMixerManager::drainRing(byte *samples, int len) {
+	const uint32 read = (uint32)SDL_AtomicGet(&_ringRead);
+	const uint32 available = ringFill(read, (uint32)SDL_AtomicGet(&_ringWrite));
+
+	uint32 copy = MIN<uint32>(len, available);
+	if (copy < (uint32)len) {
+		// The mix thread fell behind; play silence for the missing part
+		memset(samples + copy, 0, len - copy);
+		++_underruns;
+	}
+
+	const uint32 pos = read % _ringSize;
+	const uint32 first = MIN<uint32>(copy, _ringSize - pos);
+	memcpy(samples, _ring + pos, first);
+	memcpy(samples + first, _ring, copy - first);
+
+	SDL_AtomicSet(&_ringRead, (int)((read + copy) % (2 * _ringSize)));
+	SDL_SemPost(_mixSem);
+}
+
+void SdlMixerManager::mixThreadLoop() {
+	while (!SDL_AtomicGet(&_mixThreadQuit)) {
+		const uint32 write = (uint32)SDL_AtomicGet(&_ringWrite);
+		const uint32 fill = ringFill((uint32)SDL_AtomicGet(&_ringRead), write);
+
+		if (fill + _ringChunk > _ringSize) {
+			// Enough is queued; wait until the callback takes some of it. The
+			// timeout only guards against a device which stopped calling back.
+			SDL_SemWaitTimeout(_mixSem, 100);
+			continue;
+		}
+
+		// The write position only ever advances by whole chunks and the ring
+		// size is a multiple of the chunk size, so a chunk never straddles the
+		// end of the ring. An underrun in drainRing() only moves the read
+		// position up to the write position.
+		mixTimed(_ring + write % _ringSize, _ringChunk);
+		SDL_AtomicSet(&_ringWrite, (int)((write + _ringChunk) % (2 * _ringSize)));
+	}
+}
+
+int SdlMixerManager::mixThreadEntry(void *this_) {
+	SdlMixerManager *manager = (SdlMixerManager *)this_;
+	assert(manager);
+
+	manager->mixThreadLoop();
+	return 0;
+}
+#endif
+
 void SdlMixerManager::sdlCallback(void *this_, byte *samples, int len) {
 	SdlMixerManager *manager = (SdlMixerManager *)this_;
 	assert(manager);
@@ -207,12 +392,21 @@ void SdlMixerManager::sdlCallback(void *this_, byte *samples, int len) {
 
 void SdlMixerManager::suspendAudio() {
 	SDL_CloseAudio();
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	if (SDL_AtomicGet(&_mixAhead))
+		flushRing();
+#endif
 	_audioSuspended = true;
 }
 
 int SdlMixerManager::resumeAudio() {
 	if (!_audioSuspended)
 		return -2;
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	// Do not replay what was mixed ahead before or while suspended
+	if (SDL_AtomicGet(&_mixAhead))
+		flushRing();
+#endif
 	if (SDL_OpenAudio(&_obtained, NULL) < 0) {
 		return -1;
 	}
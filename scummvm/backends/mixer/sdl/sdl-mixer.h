@@ -92,6 +92,52 @@ protected:
 	 * by subclasses, so it invokes the non-static function callbackHandler()
 	 */
 	static void sdlCallback(void *this_, byte *samples, int len);
+
+	/** Number of callbacks which could not be served in time */
+	uint32 _underruns;
+
+	/** Longest time spent mixing one buffer, in microseconds */
+	uint32 _worstMixTime;
+
+	/**
+	 * Mix one buffer with the mixer implementation, keeping track of the
+	 * time it took.
+	 *
+	 * @return the time spent mixing, in microseconds.
+	 */
+	uint32 mixTimed(byte *samples, int len);
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	/**
+	 * Mix-ahead mode: a dedicated thread renders audio into a ring buffer
+	 * "audio_mix_ahead" milliseconds ahead of playback, and the SDL callback
+	 * only copies from it. Slow streams then no longer stall SDL's audio
+	 * thread, at the price of that much extra latency.
+	 *
+	 * The ring has a single producer (the mix thread) and a single consumer
+	 * (the SDL callback), so the read and write positions are the only
+	 * shared state and need no lock. The callback only looks at _mixAhead,
+	 * which is set once the thread runs and cleared under the audio lock
+	 * before the ring is freed; _mixThread is only used by the main thread.
+	 */
+	SDL_atomic_t _mixAhead;
+	SDL_Thread *_mixThread;
+	SDL_sem *_mixSem;
+	SDL_atomic_t _mixThreadQuit;
+	byte *_ring;
+	uint32 _ringSize;
+	uint32 _ringChunk;
+	SDL_atomic_t _ringRead;
+	SDL_atomic_t _ringWrite;
+
+	void startMixThread(uint32 leadTime);
+	void stopMixThread();
+	uint32 ringFill(uint32 read, uint32 write) const;
+	void flushRing();
+	void drainRing(byte *samples, int len);
+	void mixThreadLoop();
+	static int mixThreadEntry(void *this_);
+#endif
 };
 
 #endif
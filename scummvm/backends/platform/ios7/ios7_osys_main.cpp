@@ -90,6 +90,7 @@ public:
 	virtual bool removeSavefile(const Common::String &filename) override {
 		Common::String chrootedFile = getSavePath() + "/" + filename;
 		Common::String realFilePath = _sandboxRootPath + chrootedFile;
+		nextGeneration();
 
 		if (remove(realFilePath.c_str()) != 0) {
 			if (errno == EACCES)
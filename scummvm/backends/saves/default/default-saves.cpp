@@ -42,6 +42,7 @@
 #include "common/fs.h"
 #include "common/archive.h"
 #include "common/config-manager.h"
+#include "common/lz4.h"
 #include "common/zlib.h"
 
 #ifndef _WIN32_WCE
@@ -52,13 +53,25 @@
 const char *DefaultSaveFileManager::TIMESTAMPS_FILENAME = "timestamps";
 #endif
 
-DefaultSaveFileManager::DefaultSaveFileManager() {
+DefaultSaveFileManager::DefaultSaveFileManager() : _generation(1) {
 }
 
-DefaultSaveFileManager::DefaultSaveFileManager(const Common::String &defaultSavepath) {
+DefaultSaveFileManager::DefaultSaveFileManager(const Common::String &defaultSavepath) : _generation(1) {
 	ConfMan.registerDefault("savepath", defaultSavepath);
 }
 
+void DefaultSaveFileManager::nextGeneration() {
+	// 0 means "not tracked", skip it on wrap around
+	if (++_generation == 0)
+		_generation = 1;
+}
+
+uint32 DefaultSaveFileManager::getSavefilesGeneration() {
+	// Switching the save path rebuilds the cache, which starts a new generation
+	assureCached(getSavePath());
+	return _generation;
+}
+
 
 void DefaultSaveFileManager::checkPath(const Common::FSNode &dir) {
 	clearError();
@@ -74,6 +87,7 @@ void DefaultSaveFileManager::checkPath(const Common::FSNode &dir) {
 void DefaultSaveFileManager::updateSavefilesList(Common::StringArray &lockedFiles) {
 	//make it refresh the cache next time it lists the saves
 	_cachedDirectory = "";
+	nextGeneration();
 
 	//remember the locked files list because some of these files don't exist yet
 	_lockedFiles = lockedFiles;
@@ -92,7 +106,7 @@ Common::StringArray DefaultSaveFileManager::listSavefiles(const Common::String &
 
 	Common::StringArray results;
 	for (SaveFileCache::const_iterator file = _saveFileCache.begin(), end = _saveFileCache.end(); file != end; ++file) {
-		if (!locked.contains(file->_key) && file->_key.matchString(pattern, true)) {
+		if (file->_key.matchString(pattern, true) && (locked.empty() || !locked.contains(file->_key))) {
 			results.push_back(file->_key);
 		}
 	}
@@ -173,10 +187,20 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 	Common::WriteStream *const sf = fileNode.createWriteStream();
 	if (!sf)
 		return nullptr;
-	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	Common::WriteStream *out = sf;
+	if (compress) {
+		// LZ4 is much faster than gzip at the cost of larger files, loading
+		// detects either format
+		if (ConfMan.get("savegame_compression").equalsIgnoreCase("lz4"))
+			out = Common::wrapLZ4WriteStream(sf);
+		else
+			out = Common::wrapCompressedWriteStream(sf);
+	}
+	Common::OutSaveFile *const result = new Common::OutSaveFile(out);
 
 	// Add file to cache now that it exists.
 	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
+	nextGeneration();
 
 	return result;
 }
@@ -206,6 +230,7 @@ bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 		// Remove from cache, this invalidates the 'file' iterator.
 		_saveFileCache.erase(file);
 		file = _saveFileCache.end();
+		nextGeneration();
 
 		// FIXME: remove does not exist on all systems. If your port fails to
 		// compile because of this, please let us know (scummvm-devel).
@@ -264,6 +289,7 @@ void DefaultSaveFileManager::assureCached(const Common::String &savePathName) {
 
 	_saveFileCache.clear();
 	_cachedDirectory.clear();
+	nextGeneration();
 
 	if (getError().getCode() != Common::kNoError) {
 		warning("DefaultSaveFileManager::assureCached: Can not cache path '%s': '%s'", savePathName.c_str(), getErrorDesc().c_str());
@@ -45,6 +45,7 @@ public:
 	virtual Common::InSaveFile *openForLoading(const Common::String &filename);
 	virtual Common::OutSaveFile *openForSaving(const Common::String &filename, bool compress = true);
 	virtual bool removeSavefile(const Common::String &filename);
+	virtual uint32 getSavefilesGeneration();
 
 #ifdef USE_LIBCURL
 
@@ -95,7 +96,15 @@ protected:
 	 */
 	Common::StringArray _lockedFiles;
 
+	/**
+	 * Advance the generation returned by getSavefilesGeneration(). Needs to
+	 * be called whenever _saveFileCache or the files in it change.
+	 */
+	void nextGeneration();
+
 private:
+	uint32 _generation;
+
 	/**
 	 * The currently cached directory.
 	 */
@@ -22,6 +22,7 @@
 
 #include "common/scummsys.h"
 #include "backends/timer/default/default-timer.h"
+#include "common/debug.h"
 #include "common/util.h"
 #include "common/system.h"
 
@@ -34,11 +35,23 @@ struct TimerSlot {
 	uint32 nextFireTime;	// in milliseconds
 	uint32 nextFireTimeMicro;	// microseconds part of nextFire
 
+	// Statistics, times are in milliseconds
+	uint32 invocations;
+	uint32 maxLateness;
+	uint32 totalTime;
+	uint32 maxTime;
+
 	TimerSlot *next;
 
-	TimerSlot() : callback(nullptr), refCon(nullptr), interval(0), nextFireTime(0), nextFireTimeMicro(0), next(nullptr) {}
+	TimerSlot() : callback(nullptr), refCon(nullptr), interval(0), nextFireTime(0), nextFireTimeMicro(0),
+		invocations(0), maxLateness(0), totalTime(0), maxTime(0), next(nullptr) {}
 };
 
+static void printSlotStats(const TimerSlot *slot) {
+	debug(2, "Timer '%s' (%u us): %u calls, %u ms total, %u ms max, %u ms max lateness",
+	      slot->id.c_str(), slot->interval, slot->invocations, slot->totalTime, slot->maxTime, slot->maxLateness);
+}
+
 void insertPrioQueue(TimerSlot *head, TimerSlot *newSlot) {
 	// The head points to a fake anchor TimerSlot; this common
 	// trick allows us to get rid of many special cases.
@@ -73,6 +86,8 @@ DefaultTimerManager::~DefaultTimerManager() {
 	TimerSlot *slot = _head;
 	while (slot) {
 		TimerSlot *next = slot->next;
+		if (slot != _head)
+			printSlotStats(slot);
 		delete slot;
 		slot = next;
 	}
@@ -86,16 +101,20 @@ void DefaultTimerManager::handler() {
 
 	// Repeat as long as there is a TimerSlot that is scheduled to fire.
 	TimerSlot *slot = _head->next;
-	while (slot && slot->nextFireTime < curTime) {
+	while (slot && slot->nextFireTime <= curTime) {
 		// Remove the slot from the priority queue
 		_head->next = slot->next;
 
+		const uint32 lateness = curTime - slot->nextFireTime;
+		if (lateness > slot->maxLateness)
+			slot->maxLateness = lateness;
+
 		// Update the fire time and reinsert the TimerSlot into the priority
 		// queue.
 		assert(slot->interval > 0);
 		slot->nextFireTime += (slot->interval / 1000);
 		slot->nextFireTimeMicro += (slot->interval % 1000);
-		if (slot->nextFireTimeMicro > 1000) {
+		if (slot->nextFireTimeMicro >= 1000) {
 			slot->nextFireTime += slot->nextFireTimeMicro / 1000;
 			slot->nextFireTimeMicro %= 1000;
 		}
@@ -103,13 +122,27 @@ void DefaultTimerManager::handler() {
 
 		// Invoke the timer callback
 		assert(slot->callback);
+		const uint32 startTime = g_system->getMillis(true);
 		slot->callback(slot->refCon);
+		const uint32 spent = g_system->getMillis(true) - startTime;
+
+		slot->invocations++;
+		slot->totalTime += spent;
+		if (spent > slot->maxTime)
+			slot->maxTime = spent;
 
 		// Look at the next scheduled timer
 		slot = _head->next;
 	}
 }
 
+void DefaultTimerManager::printStats() {
+	Common::StackLock lock(_mutex);
+
+	for (const TimerSlot *slot = _head->next; slot; slot = slot->next)
+		printSlotStats(slot);
+}
+
 bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, void *refCon, const Common::String &id) {
 	assert(interval > 0);
 	Common::StackLock lock(_mutex);
@@ -150,6 +183,7 @@ void DefaultTimerManager::removeTimerProc(TimerProc callback) {
 	while (slot->next) {
 		if (slot->next->callback == callback) {
 			TimerSlot *next = slot->next->next;
+			printSlotStats(slot->next);
 			delete slot->next;
 			slot->next = next;
 		} else {
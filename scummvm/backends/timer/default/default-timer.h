@@ -48,6 +48,13 @@ public:
 	 * Timer callback, to be invoked at regular time intervals by the backend.
 	 */
 	void handler();
+
+	/**
+	 * Log the invocation count, time spent and maximum lateness of every
+	 * installed timer at debug level 2. The same is logged for a timer when
+	 * it is removed.
+	 */
+	void printStats();
 };
 
 #endif
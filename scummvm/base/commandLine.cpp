@@ -125,11 +125,15 @@ static const char HELP_STRING[] =
 	"                           acorn, amiga, atari, c64, fmtowns, nes, mac, pc, pc98,\n"
 	"                           pce, segacd, wii, windows)\n"
 	"  --savepath=PATH          Path to where saved games are stored\n"
+	"  --savegame-compression=CODEC\n"
+	"                           Compress saved games with gzip (default) or lz4\n"
+	"                           (faster, larger files)\n"
 	"  --extrapath=PATH         Extra path to additional game data\n"
 	"  --soundfont=FILE         Select the SoundFont for MIDI playback (only\n"
 	"                           supported by some MIDI drivers)\n"
 	"  --multi-midi             Enable combination AdLib and native MIDI\n"
 	"  --native-mt32            True Roland MT-32 (disable GM emulation)\n"
+	"  --mt32-performance-mode  Trade MT-32 emulation accuracy for lower CPU usage\n"
 	"  --enable-gs              Enable Roland GS mode for MIDI playback\n"
 	"  --output-rate=RATE       Select output sample rate in Hz (e.g. 22050)\n"
 	"  --opl-driver=DRIVER      Select AdLib (OPL) emulator (db, mame"
@@ -233,6 +237,7 @@ void registerDefaults() {
 
 	ConfMan.registerDefault("music_driver", "auto");
 	ConfMan.registerDefault("mt32_device", "null");
+	ConfMan.registerDefault("mt32_performance_mode", false);
 	ConfMan.registerDefault("gm_device", "null");
 	ConfMan.registerDefault("opl2lpt_parport", "null");
 
@@ -249,6 +254,7 @@ void registerDefaults() {
 	ConfMan.registerDefault("dump_scripts", false);
 	ConfMan.registerDefault("save_slot", -1);
 	ConfMan.registerDefault("autosave_period", 5 * 60); // By default, trigger autosave every 5 minutes
+	ConfMan.registerDefault("savegame_compression", "gzip");
 
 #if defined(ENABLE_SCUMM) || defined(ENABLE_SWORD2)
 	ConfMan.registerDefault("object_labels", true);
@@ -582,6 +588,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_OPTION_BOOL("native-mt32")
 			END_OPTION
 
+			DO_LONG_OPTION_BOOL("mt32-performance-mode")
+			END_OPTION
+
 			DO_LONG_OPTION_BOOL("enable-gs")
 			END_OPTION
 
@@ -603,6 +612,11 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 				}
 			END_OPTION
 
+			DO_LONG_OPTION("savegame-compression")
+				if (scumm_stricmp(option, "gzip") && scumm_stricmp(option, "lz4"))
+					usage("Unrecognized saved game compression '%s'", option);
+			END_OPTION
+
 			DO_LONG_OPTION("extrapath")
 				Common::FSNode path(option);
 				if (!path.exists()) {
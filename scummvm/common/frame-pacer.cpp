@@ -0,0 +1,163 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/frame-pacer.h"
+#include "common/algorithm.h"
+#include "common/system.h"
+#include "common/util.h"
+
+namespace Common {
+
+enum {
+	// Upper bound for the oversleep compensation, in 1/16 ms. Anything worse
+	// than this is a scheduling hiccup and not the usual timer slack.
+	kMaxOversleep = 4 * 16
+};
+
+FramePacer::FramePacer(uint32 ticksPerSecond, uint32 displayRate) : _system(g_system),
+		_tickMicros(0), _refreshMillis(0), _deadline(0), _deadlineMicro(0),
+		_frameStart(0), _lastUpdate(0), _lastFrameUpdate(0), _frameUpdated(false), _updatePending(false), _oversleep(0) {
+	setTickRate(ticksPerSecond);
+	setDisplayRate(displayRate);
+	resetStats();
+}
+
+void FramePacer::setTickRate(uint32 ticksPerSecond) {
+	assert(ticksPerSecond > 0);
+	_tickMicros = 1000000 / ticksPerSecond;
+}
+
+void FramePacer::setDisplayRate(uint32 refreshPerSecond) {
+	assert(refreshPerSecond > 0);
+	_refreshMillis = 1000 / refreshPerSecond;
+}
+
+void FramePacer::startFrame(uint32 ticks) {
+	const uint32 now = _system->getMillis();
+
+	if (_frames > 0)
+		_histogram[MIN<uint32>(now - _frameStart, kHistogramSize - 1)]++;
+	_frames++;
+	_frameStart = now;
+	_frameUpdated = false;
+
+	uint32 micro = _deadlineMicro + ticks * _tickMicros;
+	uint32 deadline = _deadline + micro / 1000;
+	micro %= 1000;
+
+	if ((int32)(deadline - now) < 0) {
+		// The previous frame ran late. Restart from now instead of rushing
+		// through the following frames to make up for it.
+		if (_frames > 1)
+			_missedDeadlines++;
+		deadline = now;
+		micro = 0;
+	}
+
+	_deadline = deadline;
+	_deadlineMicro = micro;
+}
+
+bool FramePacer::delayUntil(uint32 time, uint32 maxMsecs) {
+	const uint32 now = _system->getMillis();
+	const int32 remaining = (int32)(time - now);
+	if (remaining <= 0)
+		return true;
+
+	// Always sleep at least 1 ms, as delayMillis(0) would only make the
+	// caller spin until the deadline
+	uint32 sleep = MIN<uint32>(remaining, maxMsecs);
+	const uint32 compensation = (_oversleep + 8) / 16;
+	sleep = (sleep > compensation) ? sleep - compensation : 1;
+
+	_system->delayMillis(sleep);
+
+	// Running average of how much longer delayMillis took than asked
+	const uint32 after = _system->getMillis();
+	const uint32 slept = after - now;
+	const uint32 over = (slept > sleep) ? MIN<uint32>((slept - sleep) * 16, kMaxOversleep) : 0;
+	_oversleep = (_oversleep * 7 + over) / 8;
+
+	return (int32)(time - after) <= 0;
+}
+
+bool FramePacer::updateScreen() {
+	const uint32 now = _system->getMillis();
+
+	const uint32 elapsed = now - (_frameUpdated ? _lastUpdate : _lastFrameUpdate);
+	if (elapsed < _refreshMillis) {
+		_coalescedUpdates++;
+		_updatePending = true;
+		return false;
+	}
+
+	_system->updateScreen();
+	_updatePending = false;
+	_lastUpdate = now;
+	if (!_frameUpdated)
+		_lastFrameUpdate = now;
+	_frameUpdated = true;
+	_screenUpdates++;
+	return true;
+}
+
+void FramePacer::flushScreen() {
+	if (!_updatePending)
+		return;
+
+	const uint32 now = _system->getMillis();
+
+	_system->updateScreen();
+	_updatePending = false;
+	_lastUpdate = now;
+	if (!_frameUpdated)
+		_lastFrameUpdate = now;
+	_frameUpdated = true;
+	_screenUpdates++;
+}
+
+String FramePacer::getStats() const {
+	String stats = String::format("%u frames, %u missed deadlines, %u screen updates, %u coalesced, oversleep %u.%02u ms\n",
+	                              _frames, _missedDeadlines, _screenUpdates, _coalescedUpdates, _oversleep / 16, (_oversleep % 16) * 100 / 16);
+
+	for (uint i = 0; i < kHistogramSize; ++i) {
+		if (!_histogram[i])
+			continue;
+
+		if (i == kHistogramSize - 1)
+			stats += String::format("  >= %2u ms: %u\n", i, _histogram[i]);
+		else
+			stats += String::format("     %2u ms: %u\n", i, _histogram[i]);
+	}
+
+	return stats;
+}
+
+void FramePacer::resetStats() {
+	Common::fill(&_histogram[0], &_histogram[kHistogramSize], 0);
+	_frames = 0;
+	_missedDeadlines = 0;
+	_screenUpdates = 0;
+	_coalescedUpdates = 0;
+}
+
+} // End of namespace Common
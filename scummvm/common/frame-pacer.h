@@ -0,0 +1,133 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_FRAME_PACER_H
+#define COMMON_FRAME_PACER_H
+
+#include "common/scummsys.h"
+#include "common/str.h"
+
+class OSystem;
+
+namespace Common {
+
+/**
+ * Paces an engine main loop to a fixed tick rate, e.g. the 60 Hz jiffies
+ * of SCUMM and SCI.
+ *
+ * Frame deadlines are chained from the previous deadline with microsecond
+ * precision, so rounding ticks to milliseconds does not add up to drift.
+ * If a frame starts after its deadline already passed, the chain restarts
+ * from the current time instead of trying to catch up.
+ *
+ * Sleeps are shortened by the measured oversleep of OSystem::delayMillis,
+ * and updateScreen() calls arriving faster than the display refresh rate
+ * within one frame are coalesced. flushScreen() shows a coalesced update
+ * once the frame is over, so the last picture of a frame is never lost.
+ */
+class FramePacer {
+public:
+	enum {
+		/** Number of 1 ms buckets in the frame time histogram, the last one collects everything longer. */
+		kHistogramSize = 64
+	};
+
+	FramePacer(uint32 ticksPerSecond = 60, uint32 displayRate = 60);
+
+	/** Set the duration of one tick passed to startFrame(). */
+	void setTickRate(uint32 ticksPerSecond);
+
+	/** Set the rate above which updateScreen() calls are coalesced. */
+	void setDisplayRate(uint32 refreshPerSecond);
+
+	/**
+	 * Start a new frame which should end @p ticks ticks after the deadline
+	 * of the previous one.
+	 */
+	void startFrame(uint32 ticks);
+
+	/** Return the deadline of the current frame, in OSystem::getMillis() time. */
+	uint32 getDeadline() const { return _deadline; }
+
+	/**
+	 * Sleep towards the deadline of the current frame, but at most for
+	 * @p maxMsecs milliseconds, so the caller can keep pumping events.
+	 * @return true once the deadline has been reached
+	 */
+	bool delay(uint32 maxMsecs) { return delayUntil(_deadline, maxMsecs); }
+
+	/**
+	 * Same as delay(), but towards an arbitrary time instead of the frame
+	 * deadline. The frame deadline is not changed.
+	 */
+	bool delayUntil(uint32 time, uint32 maxMsecs);
+
+	/**
+	 * Call OSystem::updateScreen(), unless it would show more than one
+	 * picture per display refresh. The first call of a frame is measured
+	 * against the first update of the previous frame, so a new frame is
+	 * shown right away unless frames come faster than the display refresh.
+	 * Further calls within a frame, which usually only move the mouse
+	 * cursor, are measured against the last update.
+	 * @return true if the screen was updated
+	 */
+	bool updateScreen();
+
+	/**
+	 * Call OSystem::updateScreen() if the last updateScreen() call was
+	 * coalesced. To be called when the frame ends.
+	 */
+	void flushScreen();
+
+	/** Return the frame time histogram and pacing counters as printable text. */
+	String getStats() const;
+
+	void resetStats();
+
+private:
+	OSystem *_system;
+
+	uint32 _tickMicros;
+	uint32 _refreshMillis;
+
+	uint32 _deadline;       ///< in milliseconds
+	uint32 _deadlineMicro;  ///< microseconds part of _deadline
+
+	uint32 _frameStart;
+	uint32 _lastUpdate;
+	uint32 _lastFrameUpdate;
+	bool _frameUpdated;
+	bool _updatePending;    ///< an update was coalesced and not shown yet
+
+	/** Average oversleep of OSystem::delayMillis, in 1/16 ms. */
+	uint32 _oversleep;
+
+	uint32 _histogram[kHistogramSize];
+	uint32 _frames;
+	uint32 _missedDeadlines;
+	uint32 _screenUpdates;
+	uint32 _coalescedUpdates;
+};
+
+} // End of namespace Common
+
+#endif
@@ -0,0 +1,524 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/lz4.h"
+#include "common/debug.h"
+#include "common/endian.h"
+#include "common/ptr.h"
+#include "common/stream.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+namespace Common {
+
+/*
+ * LZ4 block format: a block is a sequence of
+ *   token            high nibble: literal count, low nibble: match length - 4
+ *   [literal count]  continued in 255 steps if the nibble is 15
+ *   literals
+ *   offset           uint16LE, distance back to the match
+ *   [match length]   continued in 255 steps if the nibble is 15
+ * The last sequence of a block only has literals, the last 5 bytes of a
+ * block are always literals and the last match starts at least 12 bytes
+ * before the end.
+ *
+ * Stream format written by wrapLZ4WriteStream():
+ *   'SLZ4'
+ *   blocks of
+ *     uint32LE  uncompressed size, at most kLZ4BlockSize
+ *     uint32LE  compressed size, the top bit is set for stored blocks
+ *     data
+ *   uint32LE 0  end marker
+ *   uint32LE    total uncompressed size
+ */
+
+enum {
+	kLZ4MinMatch = 4,
+	kLZ4LastLiterals = 5,
+	kLZ4MatchFindLimit = 12,
+	kLZ4MaxOffset = 65535,
+	kLZ4HashLog = 12
+};
+
+static const uint32 kLZ4BlockSize = 64 * 1024;
+static const uint32 kLZ4StoredFlag = 0x80000000;
+static const uint32 kLZ4StreamMagic = MKTAG('S', 'L', 'Z', '4');
+
+uint32 compressLZ4Bound(uint32 srcLen) {
+	return srcLen + srcLen / 255 + 16;
+}
+
+static byte *writeLZ4Length(byte *op, uint32 len) {
+	while (len >= 255) {
+		*op++ = 255;
+		len -= 255;
+	}
+	*op++ = len;
+	return op;
+}
+
+uint32 compressLZ4(byte *dst, uint32 dstLen, const byte *src, uint32 srcLen) {
+	uint32 table[1 << kLZ4HashLog];
+	memset(table, 0, sizeof(table));
+
+	const byte *ip = src;
+	const byte *anchor = src;
+	const byte *const end = src + srcLen;
+	byte *op = dst;
+	byte *const opEnd = dst + dstLen;
+
+	if (srcLen > kLZ4MatchFindLimit) {
+		const byte *const matchFindLimit = end - kLZ4MatchFindLimit;
+		const byte *const matchLimit = end - kLZ4LastLiterals;
+
+		while (ip < matchFindLimit) {
+			const uint32 sequence = READ_LE_UINT32(ip);
+			const uint32 hash = (sequence * 2654435761U) >> (32 - kLZ4HashLog);
+			const byte *ref = src + table[hash];
+			table[hash] = ip - src;
+
+			if (ref >= ip || ip - ref > kLZ4MaxOffset || READ_LE_UINT32(ref) != sequence) {
+				// Step faster through data which does not compress
+				ip += 1 + ((ip - anchor) >> 6);
+				continue;
+			}
+
+			// Extend the match backwards into the pending literals
+			while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+				--ip;
+				--ref;
+			}
+
+			const byte *matchEnd = ip + kLZ4MinMatch;
+			const byte *refEnd = ref + kLZ4MinMatch;
+			while (matchEnd < matchLimit && *matchEnd == *refEnd) {
+				++matchEnd;
+				++refEnd;
+			}
+
+			const uint32 literals = ip - anchor;
+			const uint32 matchLen = matchEnd - ip - kLZ4MinMatch;
+			if ((uint32)(opEnd - op) < 1 + literals / 255 + 1 + literals + 2 + matchLen / 255 + 1)
+				return 0;
+
+			byte *token = op++;
+			if (literals >= 15) {
+				*token = 15 << 4;
+				op = writeLZ4Length(op, literals - 15);
+			} else {
+				*token = literals << 4;
+			}
+			memcpy(op, anchor, literals);
+			op += literals;
+
+			WRITE_LE_UINT16(op, ip - ref);
+			op += 2;
+
+			if (matchLen >= 15) {
+				*token |= 15;
+				op = writeLZ4Length(op, matchLen - 15);
+			} else {
+				*token |= matchLen;
+			}
+
+			ip = matchEnd;
+			anchor = ip;
+		}
+	}
+
+	// The remaining data is stored as literals
+	const uint32 literals = end - anchor;
+	if ((uint32)(opEnd - op) < 1 + literals / 255 + 1 + literals)
+		return 0;
+
+	if (literals >= 15) {
+		*op++ = 15 << 4;
+		op = writeLZ4Length(op, literals - 15);
+	} else {
+		*op++ = literals << 4;
+	}
+	memcpy(op, anchor, literals);
+	op += literals;
+
+	return op - dst;
+}
+
+static bool readLZ4Length(const byte *&ip, const byte *end, uint32 &len) {
+	byte b;
+	do {
+		if (ip >= end)
+			return false;
+		b = *ip++;
+		len += b;
+	} while (b == 255);
+
+	return true;
+}
+
+bool decompressLZ4(byte *dst, uint32 dstLen, const byte *src, uint32 srcLen) {
+	const byte *ip = src;
+	const byte *const end = src + srcLen;
+	byte *op = dst;
+	byte *const opEnd = dst + dstLen;
+
+	while (ip < end) {
+		const byte token = *ip++;
+
+		uint32 len = token >> 4;
+		if (len == 15 && !readLZ4Length(ip, end, len))
+			return false;
+		if ((uint32)(end - ip) < len || (uint32)(opEnd - op) < len)
+			return false;
+		memcpy(op, ip, len);
+		op += len;
+		ip += len;
+
+		// The last sequence has no match
+		if (ip == end)
+			break;
+
+		if (end - ip < 2)
+			return false;
+		const uint32 offset = READ_LE_UINT16(ip);
+		ip += 2;
+		if (offset == 0 || offset > (uint32)(op - dst))
+			return false;
+
+		len = token & 15;
+		if (len == 15 && !readLZ4Length(ip, end, len))
+			return false;
+		len += kLZ4MinMatch;
+		if ((uint32)(opEnd - op) < len)
+			return false;
+
+		const byte *ref = op - offset;
+		if (offset >= len) {
+			memcpy(op, ref, len);
+			op += len;
+		} else {
+			// Overlapping match, repeats the last offset bytes
+			while (len--)
+				*op++ = *ref++;
+		}
+	}
+
+	return op == opEnd;
+}
+
+/**
+ * A simple wrapper class which can be used to wrap around an arbitrary
+ * other SeekableReadStream and will then provide on-the-fly decompression
+ * of data written by LZ4WriteStream.
+ */
+class LZ4ReadStream : public SeekableReadStream {
+protected:
+	ScopedPtr<SeekableReadStream> _wrapped;
+	byte *_block;
+	byte *_compressed;
+	uint32 _blockSize;  ///< Decompressed size of the current block
+	uint32 _blockPos;   ///< Read position in the current block
+	uint32 _pos;
+	uint32 _size;
+	bool _eos;
+	bool _err;
+	bool _lastBlock;
+
+	/**
+	 * Read the header of the next block.
+	 * @return false at the end of the stream
+	 */
+	bool readBlockHeader(uint32 &rawSize, uint32 &compSize) {
+		rawSize = _wrapped->readUint32LE();
+		if (_wrapped->err() || _wrapped->eos()) {
+			_err = true;
+			return false;
+		}
+		if (rawSize == 0) {
+			_lastBlock = true;
+			return false;
+		}
+
+		compSize = _wrapped->readUint32LE();
+		const uint32 dataSize = compSize & ~kLZ4StoredFlag;
+		if (_wrapped->err() || _wrapped->eos() || rawSize > kLZ4BlockSize ||
+		        ((compSize & kLZ4StoredFlag) ? dataSize != rawSize : dataSize > compressLZ4Bound(kLZ4BlockSize))) {
+			warning("LZ4ReadStream: Invalid block header");
+			_err = true;
+			return false;
+		}
+
+		return true;
+	}
+
+	bool readBlock() {
+		_blockSize = _blockPos = 0;
+
+		uint32 rawSize, compSize;
+		if (_lastBlock || !readBlockHeader(rawSize, compSize))
+			return false;
+
+		if (compSize & kLZ4StoredFlag) {
+			if (_wrapped->read(_block, rawSize) != rawSize) {
+				_err = true;
+				return false;
+			}
+		} else {
+			if (_wrapped->read(_compressed, compSize) != compSize || !decompressLZ4(_block, rawSize, _compressed, compSize)) {
+				warning("LZ4ReadStream: Corrupted block");
+				_err = true;
+				return false;
+			}
+		}
+
+		_blockSize = rawSize;
+		return true;
+	}
+
+	void rewind() {
+		_wrapped->seek(4, SEEK_SET);
+		_blockSize = _blockPos = 0;
+		_pos = 0;
+		_lastBlock = false;
+	}
+
+public:
+	LZ4ReadStream(SeekableReadStream *w) : _wrapped(w), _blockSize(0), _blockPos(0), _pos(0), _size(0),
+			_eos(false), _err(false), _lastBlock(false) {
+		assert(w != nullptr);
+
+		_block = new byte[kLZ4BlockSize];
+		_compressed = new byte[compressLZ4Bound(kLZ4BlockSize)];
+
+		// Retrieve the original file size
+		w->seek(-4, SEEK_END);
+		_size = w->readUint32LE();
+
+		w->seek(0, SEEK_SET);
+		if (w->readUint32BE() != kLZ4StreamMagic)
+			_err = true;
+	}
+
+	~LZ4ReadStream() {
+		delete[] _block;
+		delete[] _compressed;
+	}
+
+	bool err() const { return _err; }
+	void clearErr() {
+		// only reset _eos; I/O errors are not recoverable
+		_eos = false;
+	}
+
+	uint32 read(void *dataPtr, uint32 dataSize) {
+		byte *dst = (byte *)dataPtr;
+		uint32 done = 0;
+
+		while (done < dataSize) {
+			if (_blockPos == _blockSize && (_err || !readBlock())) {
+				_eos = true;
+				break;
+			}
+
+			const uint32 n = MIN(dataSize - done, _blockSize - _blockPos);
+			memcpy(dst + done, _block + _blockPos, n);
+			_blockPos += n;
+			done += n;
+		}
+
+		_pos += done;
+		return done;
+	}
+
+	bool eos() const { return _eos; }
+	int32 pos() const { return _pos; }
+	int32 size() const { return _size; }
+
+	bool seek(int32 offset, int whence = SEEK_SET) {
+		int32 newPos = 0;
+		switch (whence) {
+		case SEEK_SET:
+			newPos = offset;
+			break;
+		case SEEK_CUR:
+			newPos = _pos + offset;
+			break;
+		case SEEK_END:
+			newPos = size() + offset;
+			break;
+		}
+
+		assert(newPos >= 0);
+
+		const uint32 blockStart = _pos - _blockPos;
+		if ((uint32)newPos < blockStart)
+			rewind();
+
+		// Skip whole blocks by their headers, only the block containing the
+		// new position is decompressed
+		while (!_err && (uint32)newPos > _pos - _blockPos + _blockSize) {
+			_pos += _blockSize - _blockPos;
+			_blockSize = _blockPos = 0;
+
+			uint32 rawSize, compSize;
+			if (_lastBlock || !readBlockHeader(rawSize, compSize))
+				break;
+
+			if ((uint32)newPos >= _pos + rawSize) {
+				_wrapped->skip(compSize & ~kLZ4StoredFlag);
+				_pos += rawSize;
+			} else {
+				_wrapped->seek(-8, SEEK_CUR);
+				if (!readBlock())
+					break;
+			}
+		}
+
+		const uint32 inBlock = MIN<uint32>(newPos - (_pos - _blockPos), _blockSize);
+		_pos = _pos - _blockPos + inBlock;
+		_blockPos = inBlock;
+
+		_eos = false;
+		return !_err;
+	}
+};
+
+/**
+ * A simple wrapper class which can be used to wrap around an arbitrary
+ * other WriteStream and will then provide on-the-fly compression into
+ * independent LZ4 blocks.
+ */
+class LZ4WriteStream : public WriteStream {
+protected:
+	ScopedPtr<WriteStream> _wrapped;
+	byte *_block;
+	byte *_compressed;
+	uint32 _blockSize;
+	uint32 _pos;
+	uint32 _written;
+	bool _err;
+	bool _finalized;
+
+	void flushBlock() {
+		if (!_blockSize || _err)
+			return;
+
+		const uint32 compSize = compressLZ4(_compressed, compressLZ4Bound(kLZ4BlockSize), _block, _blockSize);
+
+		_wrapped->writeUint32LE(_blockSize);
+		if (compSize == 0 || compSize >= _blockSize) {
+			// Incompressible data is stored as is
+			_wrapped->writeUint32LE(_blockSize | kLZ4StoredFlag);
+			_wrapped->write(_block, _blockSize);
+			_written += 8 + _blockSize;
+		} else {
+			_wrapped->writeUint32LE(compSize);
+			_wrapped->write(_compressed, compSize);
+			_written += 8 + compSize;
+		}
+
+		if (_wrapped->err())
+			_err = true;
+		_blockSize = 0;
+	}
+
+public:
+	LZ4WriteStream(WriteStream *w) : _wrapped(w), _blockSize(0), _pos(0), _written(4), _err(false), _finalized(false) {
+		assert(w != nullptr);
+
+		_block = new byte[kLZ4BlockSize];
+		_compressed = new byte[compressLZ4Bound(kLZ4BlockSize)];
+
+		_wrapped->writeUint32BE(kLZ4StreamMagic);
+	}
+
+	~LZ4WriteStream() {
+		finalize();
+		delete[] _block;
+		delete[] _compressed;
+	}
+
+	bool err() const { return _err || _wrapped->err(); }
+
+	void clearErr() {
+		_wrapped->clearErr();
+	}
+
+	void finalize() {
+		if (_finalized)
+			return;
+		_finalized = true;
+
+		flushBlock();
+		_wrapped->writeUint32LE(0);
+		_wrapped->writeUint32LE(_pos);
+		_written += 8;
+
+		debug(2, "LZ4WriteStream: Compressed %u bytes to %u bytes", _pos, _written);
+
+		// Finalize the wrapped savefile, too
+		_wrapped->finalize();
+	}
+
+	uint32 write(const void *dataPtr, uint32 dataSize) {
+		if (err() || _finalized)
+			return 0;
+
+		const byte *src = (const byte *)dataPtr;
+		uint32 done = 0;
+		while (done < dataSize) {
+			const uint32 n = MIN<uint32>(dataSize - done, kLZ4BlockSize - _blockSize);
+			memcpy(_block + _blockSize, src + done, n);
+			_blockSize += n;
+			done += n;
+
+			if (_blockSize == kLZ4BlockSize)
+				flushBlock();
+		}
+
+		_pos += done;
+		return done;
+	}
+
+	virtual int32 pos() const { return _pos; }
+};
+
+bool isLZ4Stream(SeekableReadStream *stream) {
+	byte header[4];
+	const uint32 n = stream->read(header, sizeof(header));
+	stream->seek(-(int32)n, SEEK_CUR);
+
+	return n == sizeof(header) && READ_BE_UINT32(header) == kLZ4StreamMagic;
+}
+
+SeekableReadStream *wrapLZ4ReadStream(SeekableReadStream *toBeWrapped) {
+	if (toBeWrapped)
+		return new LZ4ReadStream(toBeWrapped);
+	return toBeWrapped;
+}
+
+WriteStream *wrapLZ4WriteStream(WriteStream *toBeWrapped) {
+	if (toBeWrapped)
+		return new LZ4WriteStream(toBeWrapped);
+	return toBeWrapped;
+}
+
+} // End of namespace Common
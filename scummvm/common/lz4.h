@@ -0,0 +1,100 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/**
+ * @file
+ * Fast LZ77 compressor and decompressor using the LZ4 block format. Used for
+ * savegames, when selected with the "savegame_compression" option, as a
+ * faster alternative to gzip.
+ */
+
+#ifndef COMMON_LZ4_H
+#define COMMON_LZ4_H
+
+#include "common/scummsys.h"
+
+namespace Common {
+
+class SeekableReadStream;
+class WriteStream;
+
+/**
+ * Return the size of the buffer needed by compressLZ4() for @p srcLen bytes
+ * of input in the worst case.
+ */
+uint32 compressLZ4Bound(uint32 srcLen);
+
+/**
+ * Compress a buffer into a single LZ4 block.
+ *
+ * @param dst       the buffer to store into.
+ * @param dstLen    the size of the destination buffer.
+ * @param src       the data to be compressed.
+ * @param srcLen    the size of the data.
+ *
+ * @return the size of the compressed data, or 0 if it did not fit into dst.
+ */
+uint32 compressLZ4(byte *dst, uint32 dstLen, const byte *src, uint32 srcLen);
+
+/**
+ * Decompress a single LZ4 block. The size of the decompressed data has to be
+ * known in advance.
+ *
+ * @param dst       the buffer to store into.
+ * @param dstLen    the exact size of the decompressed data.
+ * @param src       the data to be decompressed.
+ * @param srcLen    the size of the compressed data.
+ *
+ * @return true if the block was valid and decompressed to exactly dstLen bytes.
+ */
+bool decompressLZ4(byte *dst, uint32 dstLen, const byte *src, uint32 srcLen);
+
+/**
+ * Check whether a stream starts with the header written by
+ * wrapLZ4WriteStream(). The stream position is not changed.
+ */
+bool isLZ4Stream(SeekableReadStream *stream);
+
+/**
+ * Take a SeekableReadStream written by wrapLZ4WriteStream() and wrap it in
+ * a stream which decompresses it on the fly. Seeking forward skips whole
+ * blocks without decompressing them.
+ * The created stream also becomes responsible for freeing the passed stream.
+ *
+ * It is safe to call this with a NULL parameter (in this case, NULL is
+ * returned).
+ */
+SeekableReadStream *wrapLZ4ReadStream(SeekableReadStream *toBeWrapped);
+
+/**
+ * Take an arbitrary WriteStream and wrap it in a stream which compresses
+ * the data in independent LZ4 blocks.
+ * The created stream also becomes responsible for freeing the passed stream.
+ *
+ * It is safe to call this with a NULL parameter (in this case, NULL is
+ * returned).
+ */
+WriteStream *wrapLZ4WriteStream(WriteStream *toBeWrapped);
+
+} // End of namespace Common
+
+#endif
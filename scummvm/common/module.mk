@@ -10,6 +10,7 @@ MODULE_OBJS := \
 	EventDispatcher.o \
 	EventMapper.o \
 	file.o \
+	frame-pacer.o \
 	fs.o \
 	gui_options.o \
 	hashmap.o \
@@ -19,6 +20,7 @@ MODULE_OBJS := \
 	json.o \
 	language.o \
 	localization.o \
+	lz4.o \
 	macresman.o \
 	memorypool.o \
 	md5.o \
@@ -82,6 +82,73 @@ private:
 	List<T>	_impl;
 };
 
+/**
+ * Fixed size queue class, implemented as a ring buffer. Unlike Queue, pushing
+ * and popping never allocates memory.
+ */
+template<class T, uint MAX_SIZE = 10>
+class FixedQueue {
+public:
+	typedef uint size_type;
+
+	FixedQueue<T, MAX_SIZE>() : _head(0), _size(0) {}
+
+	bool empty() const {
+		return _size == 0;
+	}
+
+	bool full() const {
+		return _size == MAX_SIZE;
+	}
+
+	void clear() {
+		_head = 0;
+		_size = 0;
+	}
+
+	void push(const T &x) {
+		assert(_size < MAX_SIZE);
+		_queue[(_head + _size) % MAX_SIZE] = x;
+		++_size;
+	}
+
+	T &front() {
+		assert(_size > 0);
+		return _queue[_head];
+	}
+
+	const T &front() const {
+		assert(_size > 0);
+		return _queue[_head];
+	}
+
+	T &back() {
+		assert(_size > 0);
+		return _queue[(_head + _size - 1) % MAX_SIZE];
+	}
+
+	const T &back() const {
+		assert(_size > 0);
+		return _queue[(_head + _size - 1) % MAX_SIZE];
+	}
+
+	T pop() {
+		T tmp = front();
+		_head = (_head + 1) % MAX_SIZE;
+		--_size;
+		return tmp;
+	}
+
+	size_type size() const {
+		return _size;
+	}
+
+protected:
+	T         _queue[MAX_SIZE];
+	size_type _head;
+	size_type _size;
+};
+
 } // End of namespace Common
 
 #endif
@@ -205,6 +205,17 @@ public:
 	 * for saving or loading because they are being synced by CloudManager.
 	 */
 	virtual void updateSavefilesList(StringArray &lockedFiles) = 0;
+
+	/**
+	 * Return a number which changes whenever savefiles were written or
+	 * removed, or the savefile list was refreshed. Information derived from
+	 * the savefiles, like the save list of a game, only needs to be reread
+	 * when this number changes.
+	 *
+	 * @return The current generation, or 0 if the manager does not keep
+	 *         track of changes and nothing may be cached.
+	 */
+	virtual uint32 getSavefilesGeneration() { return 0; }
 };
 
 } // End of namespace Common
@@ -24,6 +24,7 @@
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
 #include "common/zlib.h"
+#include "common/lz4.h"
 #include "common/ptr.h"
 #include "common/util.h"
 #include "common/stream.h"
@@ -415,6 +416,9 @@ public:
 
 SeekableReadStream *wrapCompressedReadStream(SeekableReadStream *toBeWrapped, uint32 knownSize) {
 	if (toBeWrapped) {
+		if (isLZ4Stream(toBeWrapped))
+			return wrapLZ4ReadStream(toBeWrapped);
+
 		uint16 header = toBeWrapped->readUint16BE();
 		bool isCompressed = (header == 0x1F8B ||
 				     ((header & 0x0F00) == 0x0800 &&
@@ -105,7 +105,8 @@ bool inflateZlibInstallShield(byte *dst, uint dstLen, const byte *src, uint srcL
  * format. In the former case, the original stream is returned unmodified
  * (and in particular, not wrapped). In the latter case the stream is
  * returned wrapped, unless there is no ZLIB support, then NULL is returned
- * and the old stream is destroyed.
+ * and the old stream is destroyed. Streams written by wrapLZ4WriteStream()
+ * are detected as well and always wrapped.
  *
  * Certain GZip-formats don't supply an easily readable length, if you
  * still need the length carried along with the stream, and you know
@@ -24,6 +24,7 @@
 #define BLADERUNNER_ACTOR_H
 
 #include "bladerunner/boundingbox.h"
+#include "bladerunner/slice_renderer.h"
 #include "bladerunner/vector.h"
 
 #include "common/array.h"
@@ -54,6 +55,8 @@ public:
 	ActorCombat   *_combatInfo;
 	ActorClues    *_clues;
 
+	SliceRendererStats _renderStats;
+
 private:
 	int                _honesty;
 	int                _intelligence;
@@ -1090,6 +1090,7 @@ void BladeRunnerEngine::gameTick() {
 	}
 
 	_sliceRenderer->setView(_view);
+	_sliceRenderer->beginFrame();
 
 	// Tick and draw all actors in current set
 	int setId = _scene->getSetId();
@@ -1103,6 +1104,7 @@ void BladeRunnerEngine::gameTick() {
 	}
 
 	_items->tick();
+	_sliceRenderer->endFrame();
 
 	_itemPickup->tick();
 	_itemPickup->draw();
@@ -133,6 +133,8 @@ Debugger::Debugger(BladeRunnerEngine *vm) : GUI::Debugger() {
 	registerCmd("item", WRAP_METHOD(Debugger, cmdItem));
 	registerCmd("region", WRAP_METHOD(Debugger, cmdRegion));
 	registerCmd("click", WRAP_METHOD(Debugger, cmdClick));
+	registerCmd("render", WRAP_METHOD(Debugger, cmdRender));
+	registerCmd("vqa", WRAP_METHOD(Debugger, cmdVqa));
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 	registerCmd("effect", WRAP_METHOD(Debugger, cmdEffect));
@@ -1780,6 +1782,119 @@ bool Debugger::cmdClick(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdRender(int argc, const char **argv) {
+	bool invalidSyntax = false;
+	bool reset = false;
+
+	if (argc > 2) {
+		invalidSyntax = true;
+	} else if (argc == 2) {
+		Common::String argName = argv[1];
+		argName.toLowercase();
+		if (argName == "reset") {
+			reset = true;
+		} else {
+			invalidSyntax = true;
+		}
+	}
+
+	if (invalidSyntax) {
+		debugPrintf("Show accumulated slice rendering cost per actor, optionally resetting the counters\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	int count = 0;
+	for (int i = 0; i < _vm->kActorCount; ++i) {
+		Actor *actor = _vm->_actors[i];
+		if (actor == nullptr) {
+			continue;
+		}
+
+		SliceRendererStats &stats = actor->_renderStats;
+		if (stats.drawCount > 0 || stats.offscreenCount > 0) {
+			debugPrintf("%d: %s draws: %u, off screen: %u, lines: %u, pixels: %u\n",
+			            i,
+			            _vm->_textActorNames->getText(i),
+			            stats.drawCount,
+			            stats.offscreenCount,
+			            stats.lineCount,
+			            stats.pixelCount);
+			++count;
+		}
+
+		if (reset) {
+			stats.reset();
+		}
+	}
+	debugPrintf("%d actors were rendered.\n", count);
+
+	SliceRendererFrameStats &frameStats = _vm->_sliceRenderer->_frameStats;
+	if (frameStats.frameCount > 0) {
+		debugPrintf("Slice rendering time: %u ms over %u frames (avg: %.2f ms, max: %u ms)\n",
+		            frameStats.timeMs,
+		            frameStats.frameCount,
+		            (float)frameStats.timeMs / frameStats.frameCount,
+		            frameStats.maxTimeMs);
+	}
+	if (reset) {
+		frameStats.reset();
+	}
+
+	SetEffects *setEffects = _vm->_scene->_set->_effects;
+	debugPrintf("Set effects cache hits: %u, misses: %u\n", setEffects->_colorCacheHits, setEffects->_colorCacheMisses);
+	if (reset) {
+		setEffects->_colorCacheHits   = 0;
+		setEffects->_colorCacheMisses = 0;
+	}
+
+	return true;
+}
+
+bool Debugger::cmdVqa(int argc, const char **argv) {
+	bool invalidSyntax = false;
+	bool reset = false;
+
+	if (argc > 2) {
+		invalidSyntax = true;
+	} else if (argc == 2) {
+		Common::String argName = argv[1];
+		argName.toLowercase();
+		if (argName == "reset") {
+			reset = true;
+		} else {
+			invalidSyntax = true;
+		}
+	}
+
+	if (invalidSyntax) {
+		debugPrintf("Show decoding statistics of the scene video, optionally resetting the counters\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	VQAPlayer *vqaPlayer = _vm->_scene->_vqaPlayer;
+	if (vqaPlayer == nullptr) {
+		debugPrintf("No scene video is playing\n");
+		return true;
+	}
+
+	VQAPlayer::Stats &stats = vqaPlayer->_stats;
+	debugPrintf("Video: %s\n", vqaPlayer->_name.c_str());
+	debugPrintf("Frames decoded: %u (late: %u)\n", stats.framesDecoded, stats.framesLate);
+	debugPrintf("Decode time: %u ms (avg: %.2f ms, max: %u ms)\n",
+	            stats.decodeTimeMs,
+	            stats.framesDecoded ? (float)stats.decodeTimeMs / stats.framesDecoded : 0.0f,
+	            stats.maxDecodeTimeMs);
+	debugPrintf("Z-buffers decoded: %u, skipped: %u\n", stats.zbuffersDecoded, stats.zbuffersSkipped);
+
+	if (reset) {
+		stats.reset();
+	}
+
+	return true;
+}
+
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 bool Debugger::cmdEffect(int argc, const char **argv) {
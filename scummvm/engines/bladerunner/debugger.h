@@ -113,6 +113,8 @@ public:
 	bool cmdItem(int argc, const char **argv);
 	bool cmdRegion(int argc, const char **argv);
 	bool cmdClick(int argc, const char **argv);
+	bool cmdRender(int argc, const char **argv);
+	bool cmdVqa(int argc, const char **argv);
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 	bool cmdEffect(int argc, const char **argv);
@@ -28,6 +28,7 @@ namespace BladeRunner {
 
 Fog::Fog() {
 	_frameCount         = 0;
+	_frame              = -1;
 	_animatedParameters = 0;
 	_fogDensity         = 0.0f;
 	_animationData      = nullptr;
@@ -90,6 +91,7 @@ void Fog::readAnimationData(Common::ReadStream *stream, int size) {
 	_m33ptr = _m32ptr + ((_animatedParameters & 0x200) ? _frameCount : 1);
 	_m34ptr = _m33ptr + ((_animatedParameters & 0x400) ? _frameCount : 1);
 
+	_frame = -1;
 	setupFrame(0);
 }
 
@@ -98,6 +100,14 @@ void Fog::reset() {
 
 void Fog::setupFrame(int frame) {
 	int offset = frame % _frameCount;
+
+	// Called for every drawn actor, only recalculate the inverse matrix when
+	// the animation actually moved to another frame
+	if (offset == _frame) {
+		return;
+	}
+	_frame = offset;
+
 	_matrix._m[0][0] = ((_animatedParameters &   0x1) ? _m11ptr[offset] : *_m11ptr);
 	_matrix._m[0][1] = ((_animatedParameters &   0x2) ? _m12ptr[offset] : *_m12ptr);
 	_matrix._m[0][2] = ((_animatedParameters &   0x4) ? _m13ptr[offset] : *_m13ptr);
@@ -140,8 +150,9 @@ void FogSphere::calculateCoeficient(Vector3 position, Vector3 viewPosition, floa
 	float d = b * b - c;
 
 	if (d >= 0.0f) { // there is an interstection between ray and the sphere
-		Vector3 intersection1 = rayOrigin + (-b - sqrt(d)) * rayDirection;
-		Vector3 intersection2 = rayOrigin + (-b + sqrt(d)) * rayDirection;
+		float sqrtD = sqrt(d);
+		Vector3 intersection1 = rayOrigin + (-b - sqrtD) * rayDirection;
+		Vector3 intersection2 = rayOrigin + (-b + sqrtD) * rayDirection;
 
 		Vector3 intersection1World = _inverted * intersection1;
 		Vector3 intersection2World = _inverted * intersection2;
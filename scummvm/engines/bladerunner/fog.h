@@ -42,6 +42,7 @@ protected:
 	Common::String _name;
 
 	int        _frameCount;
+	int        _frame;
 	int        _animatedParameters;
 	Matrix4x3  _matrix;
 	Matrix4x3  _inverted;
@@ -73,6 +74,8 @@ public:
 
 	void setupFrame(int frame);
 
+	bool isAnimated() const { return _animatedParameters != 0; }
+
 protected:
 	int readCommon(Common::ReadStream *stream);
 	void readAnimationData(Common::ReadStream *stream, int count);
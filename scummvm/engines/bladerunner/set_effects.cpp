@@ -39,6 +39,12 @@ SetEffects::SetEffects(BladeRunnerEngine *vm) {
 
 	_fogCount = 0;
 	_fogs = nullptr;
+	_frame = -1;
+	_isAnimated = false;
+
+	_colorCacheHits = 0;
+	_colorCacheMisses = 0;
+	invalidateColorCache();
 }
 
 SetEffects::~SetEffects() {
@@ -73,13 +79,20 @@ void SetEffects::read(Common::ReadStream *stream, int frameCount) {
 			fog->read(stream, frameCount);
 			fog->_next = _fogs;
 			_fogs = fog;
+			_isAnimated = _isAnimated || fog->isAnimated();
 		}
 	}
+
+	_frame = -1;
+	invalidateColorCache();
 }
 
 void SetEffects::reset() {
 	Fog *nextFog;
 
+	_isAnimated = false;
+	invalidateColorCache();
+
 	if (!_fogs) {
 		return;
 	}
@@ -92,6 +105,15 @@ void SetEffects::reset() {
 }
 
 void SetEffects::setupFrame(int frame) {
+	if (frame == _frame) {
+		return;
+	}
+	_frame = frame;
+
+	if (_isAnimated) {
+		invalidateColorCache();
+	}
+
 	for (Fog *fog = _fogs; fog != nullptr; fog = fog->_next) {
 		fog->setupFrame(frame);
 	}
@@ -101,10 +123,12 @@ void SetEffects::setFadeColor(float r, float g, float b) {
 	_fadeColor.r = r;
 	_fadeColor.g = g;
 	_fadeColor.b = b;
+	invalidateColorCache();
 }
 
 void SetEffects::setFadeDensity(float density) {
 	_fadeDensity = density;
+	invalidateColorCache();
 }
 
 void SetEffects::setFogColor(const Common::String &fogName, float r, float g, float b) {
@@ -116,6 +140,7 @@ void SetEffects::setFogColor(const Common::String &fogName, float r, float g, fl
 	fog->_fogColor.r = r;
 	fog->_fogColor.g = g;
 	fog->_fogColor.b = b;
+	invalidateColorCache();
 }
 
 void SetEffects::setFogDensity(const Common::String &fogName, float density) {
@@ -125,9 +150,37 @@ void SetEffects::setFogDensity(const Common::String &fogName, float density) {
 	}
 
 	fog->_fogDensity = density;
+	invalidateColorCache();
 }
 
 void SetEffects::calculateColor(Vector3 viewPosition, Vector3 position, float *outCoeficient, Color *outColor) const {
+	uint32 hash = 0;
+	const float values[6] = { position.x, position.y, position.z, viewPosition.x, viewPosition.y, viewPosition.z };
+	for (int i = 0; i < 6; ++i) {
+		uint32 bits;
+		memcpy(&bits, &values[i], sizeof(bits));
+		hash = (hash ^ bits) * 16777619;
+	}
+
+	ColorCacheEntry &entry = _colorCache[(hash ^ (hash >> 16)) % kColorCacheSize];
+	if (entry.isValid && entry.position == position && entry.viewPosition == viewPosition) {
+		++_colorCacheHits;
+		*outCoeficient = entry.coeficient;
+		*outColor = entry.color;
+		return;
+	}
+
+	++_colorCacheMisses;
+	calculateColorUncached(viewPosition, position, outCoeficient, outColor);
+
+	entry.isValid      = true;
+	entry.viewPosition = viewPosition;
+	entry.position     = position;
+	entry.coeficient   = *outCoeficient;
+	entry.color        = *outColor;
+}
+
+void SetEffects::calculateColorUncached(Vector3 viewPosition, Vector3 position, float *outCoeficient, Color *outColor) const {
 	float distanceCoeficient = CLIP((position - viewPosition).length() * _distanceCoeficient, 0.0f, 1.0f);
 
 	*outCoeficient = 1.0f - distanceCoeficient;
@@ -154,6 +207,12 @@ void SetEffects::calculateColor(Vector3 viewPosition, Vector3 position, float *o
 	outColor->b = outColor->b * (1.0f - _fadeDensity) + _fadeColor.b * _fadeDensity;
 }
 
+void SetEffects::invalidateColorCache() {
+	for (int i = 0; i < kColorCacheSize; ++i) {
+		_colorCache[i].isValid = false;
+	}
+}
+
 Fog *SetEffects::findFog(const Common::String &fogName) const {
 	if (!_fogs) {
 		return nullptr;
@@ -42,6 +42,27 @@ class SetEffects {
 	float _fadeDensity;
 	int   _fogCount;
 	Fog  *_fogs;
+	int   _frame;
+	bool  _isAnimated;
+
+	// Slices of actors which did not move since the last frame are lit by
+	// the same set effects again, so results are kept in a small
+	// direct-mapped cache until a fog, the fade or the animation changes
+	static const int kColorCacheSize = 256;
+
+	struct ColorCacheEntry {
+		Vector3 viewPosition;
+		Vector3 position;
+		float   coeficient;
+		Color   color;
+		bool    isValid;
+	};
+
+	mutable ColorCacheEntry _colorCache[kColorCacheSize];
+
+public:
+	mutable uint32 _colorCacheHits;
+	mutable uint32 _colorCacheMisses;
 
 public:
 	SetEffects(BladeRunnerEngine *vm);
@@ -62,6 +83,9 @@ public:
 
 private:
 	Fog *findFog(const Common::String &fogName) const;
+
+	void invalidateColorCache();
+	void calculateColorUncached(Vector3 viewPosition, Vector3 position, float *outCoeficient, Color *outColor) const;
 };
 
 } // End of namespace BladeRunner
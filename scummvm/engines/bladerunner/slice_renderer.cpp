@@ -61,6 +61,18 @@ SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_m13               = 0;
 	_m23               = 0;
 
+	_frameTimeStart = 0;
+	_frameDrawCount = 0;
+
+	_setupValid     = false;
+	_setupAnimation = -1;
+	_setupFrame     = -1;
+	_setupFacing    = 0.0f;
+	_setupScale     = 0.0f;
+
+	_lineCount  = 0;
+	_pixelCount = 0;
+
 	_shadowPolygonDefault[ 0] = Vector3( 16.0f,  96.0f, 0.0f);
 	_shadowPolygonDefault[ 1] = Vector3( 16.0f, 160.0f, 0.0f);
 	_shadowPolygonDefault[ 2] = Vector3( 64.0f, 192.0f, 0.0f);
@@ -105,7 +117,31 @@ void SliceRenderer::setupFrameInWorld(int animationId, int animationFrame, Vecto
 
 	loadFrame(animationId, animationFrame);
 
+	if (isSetupCached()) {
+		return;
+	}
+
 	calculateBoundingRect();
+
+	_setupValid            = true;
+	_setupAnimation        = _animation;
+	_setupFrame            = _frame;
+	_setupPosition         = _position;
+	_setupFacing           = _facing;
+	_setupScale            = _scale;
+	_setupViewMatrix       = _view->_sliceViewMatrix;
+	_setupViewportPosition = _view->_viewportPosition;
+}
+
+bool SliceRenderer::isSetupCached() const {
+	return _setupValid
+	    && _setupAnimation == _animation
+	    && _setupFrame == _frame
+	    && _setupPosition == _position
+	    && _setupFacing == _facing
+	    && _setupScale == _scale
+	    && _setupViewportPosition == _view->_viewportPosition
+	    && memcmp(_setupViewMatrix._m, _view->_sliceViewMatrix._m, sizeof(_setupViewMatrix._m)) == 0;
 }
 
 void SliceRenderer::getScreenRectangle(Common::Rect *screenRectangle, int animationId, int animationFrame, Vector3 position, float facing, float scale) {
@@ -370,16 +406,22 @@ static void setupLookupTable(int t[256], int inc) {
 	}
 }
 
-void SliceRenderer::drawInWorld(int animationId, int animationFrame, Vector3 position, float facing, float scale, Graphics::Surface &surface, uint16 *zbuffer) {
+void SliceRenderer::drawInWorld(int animationId, int animationFrame, Vector3 position, float facing, float scale, Graphics::Surface &surface, uint16 *zbuffer, SliceRendererStats *stats) {
 	assert(_lights);
 	assert(_setEffects);
 	//assert(_view);
 
+	_lineCount  = 0;
+	_pixelCount = 0;
+
 	setupFrameInWorld(animationId, animationFrame, position, facing, scale);
 
 	assert(_sliceFramePtr);
 
 	if (_screenRectangle.isEmpty()) {
+		if (stats) {
+			stats->offscreenCount += 1;
+		}
 		return;
 	}
 
@@ -475,6 +517,30 @@ void SliceRenderer::drawInWorld(int animationId, int animationFrame, Vector3 pos
 		frameY += 1;
 		zBufferLinePtr += 640;
 	}
+
+	_frameDrawCount += 1;
+
+	if (stats) {
+		stats->drawCount  += 1;
+		stats->lineCount  += _lineCount;
+		stats->pixelCount += _pixelCount;
+	}
+}
+
+void SliceRenderer::beginFrame() {
+	_frameTimeStart = _vm->_system->getMillis();
+	_frameDrawCount = 0;
+}
+
+void SliceRenderer::endFrame() {
+	if (_frameDrawCount == 0) {
+		return;
+	}
+
+	uint32 timeSpent = _vm->_system->getMillis() - _frameTimeStart;
+	_frameStats.frameCount += 1;
+	_frameStats.timeMs     += timeSpent;
+	_frameStats.maxTimeMs   = MAX(_frameStats.maxTimeMs, timeSpent);
 }
 
 void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screenX, int screenY, float facing, float scale, Graphics::Surface &surface) {
@@ -553,6 +619,11 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 	uint32 polyCount = READ_LE_UINT32(p);
 	p += 4;
 
+	// Spans never leave the line, so resolve the destination row once
+	// instead of clipping every pixel
+	void *dstLine = surface.getBasePtr(0, CLIP(y, 0, surface.h - 1));
+	++_lineCount;
+
 	while (polyCount--) {
 		uint32 vertexCount = READ_LE_UINT32(p);
 		p += 4;
@@ -586,13 +657,16 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 						outColor = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
-						if (vertexZ < zbufferLine[x]) {
-							zbufferLine[x] = (uint16)vertexZ;
-
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
-							drawPixel(surface, dstPtr, outColor);
-						}
+					switch (surface.format.bytesPerPixel) {
+					case 1:
+						drawSpan<uint8>((uint8 *)dstLine, zbufferLine, previousVertexX, MIN(vertexX, (int)surface.w), vertexZ, outColor);
+						break;
+					case 2:
+						drawSpan<uint16>((uint16 *)dstLine, zbufferLine, previousVertexX, MIN(vertexX, (int)surface.w), vertexZ, outColor);
+						break;
+					case 4:
+						drawSpan<uint32>((uint32 *)dstLine, zbufferLine, previousVertexX, MIN(vertexX, (int)surface.w), vertexZ, outColor);
+						break;
 					}
 				}
 			}
@@ -602,6 +676,23 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 	}
 }
 
+template <typename PixelType>
+void SliceRenderer::drawSpan(PixelType *dstLine, uint16 *zbufferLine, int x1, int x2, uint16 z, uint32 color) {
+	PixelType pixel = (PixelType)color;
+	uint32 written = 0;
+
+	// Branch-free select form, so the compiler can turn the depth test
+	// into vector compares and blends over the whole span
+	for (int x = x1; x < x2; ++x) {
+		bool visible = z < zbufferLine[x];
+		zbufferLine[x] = visible ? z : zbufferLine[x];
+		dstLine[x]     = visible ? pixel : dstLine[x];
+		written       += visible;
+	}
+
+	_pixelCount += written;
+}
+
 void SliceRenderer::drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer) {
 	Matrix4x3 mOffset(
 		1.0f, 0.0f, 0.0f, _framePos.x,
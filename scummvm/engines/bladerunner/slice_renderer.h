@@ -43,6 +43,38 @@ class BladeRunnerEngine;
 class Lights;
 class SetEffects;
 
+struct SliceRendererStats {
+	uint32 drawCount;
+	uint32 offscreenCount;
+	uint32 lineCount;
+	uint32 pixelCount;
+
+	SliceRendererStats() { reset(); }
+
+	void reset() {
+		drawCount      = 0;
+		offscreenCount = 0;
+		lineCount      = 0;
+		pixelCount     = 0;
+	}
+};
+
+// A single slice draw usually takes well under a millisecond, so the time
+// is measured over all world draws of a game frame instead of per draw.
+struct SliceRendererFrameStats {
+	uint32 frameCount;
+	uint32 timeMs;
+	uint32 maxTimeMs;
+
+	SliceRendererFrameStats() { reset(); }
+
+	void reset() {
+		frameCount = 0;
+		timeMs     = 0;
+		maxTimeMs  = 0;
+	}
+};
+
 class SliceRenderer {
 	BladeRunnerEngine *_vm;
 
@@ -74,6 +106,21 @@ class SliceRenderer {
 	float        _endSlice;
 	Common::Rect _screenRectangle;
 
+	// Inputs of the last calculateBoundingRect() call. Actors set up the same
+	// frame twice per tick (draw and screen rectangle), so the projection is
+	// only recalculated when the frame, placement or camera changes.
+	bool      _setupValid;
+	int       _setupAnimation;
+	int       _setupFrame;
+	Vector3   _setupPosition;
+	float     _setupFacing;
+	float     _setupScale;
+	Matrix4x3 _setupViewMatrix;
+	Vector3   _setupViewportPosition;
+
+	uint32 _lineCount;
+	uint32 _pixelCount;
+
 	int _m11lookup[256];
 	int _m12lookup[256];
 	int _m13;
@@ -91,6 +138,12 @@ class SliceRenderer {
 
 	Graphics::PixelFormat _pixelFormat;
 
+	uint32 _frameTimeStart;
+	uint32 _frameDrawCount;
+
+public:
+	SliceRendererFrameStats _frameStats;
+
 public:
 	SliceRenderer(BladeRunnerEngine *vm);
 	~SliceRenderer();
@@ -102,19 +155,25 @@ public:
 
 	void setupFrameInWorld(int animationId, int animationFrame, Vector3 position, float facing, float scale = 1.0f);
 	void getScreenRectangle(Common::Rect *screenRectangle, int animationId, int animationFrame, Vector3 position, float facing, float scale);
-	void drawInWorld(int animationId, int animationFrame, Vector3 position, float facing, float scale, Graphics::Surface &surface, uint16 *zbuffer);
+	void drawInWorld(int animationId, int animationFrame, Vector3 position, float facing, float scale, Graphics::Surface &surface, uint16 *zbuffer, SliceRendererStats *stats = nullptr);
 	void drawOnScreen(int animationId, int animationFrame, int screenX, int screenY, float facing, float scale, Graphics::Surface &surface);
 
+	void beginFrame();
+	void endFrame();
+
 	void preload(int animationId);
 
 	void disableShadows(int *animationsIdsList, int listSize);
 
 private:
+	bool isSetupCached() const;
 	void calculateBoundingRect();
 	Matrix3x2 calculateFacingRotationMatrix();
 	void loadFrame(int animation, int frame);
 
 	void drawSlice(int slice, bool advanced, int y, Graphics::Surface &surface, uint16 *zbufferLine);
+	template <typename PixelType>
+	void drawSpan(PixelType *dstLine, uint16 *zbufferLine, int x1, int x2, uint16 z, uint32 color);
 	void drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 	void drawShadowPolygon(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 };
@@ -83,6 +83,14 @@ public:
 	}
 };
 
+inline bool operator==(const Vector3 &a, const Vector3 &b) {
+	return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+inline bool operator!=(const Vector3 &a, const Vector3 &b) {
+	return !(a == b);
+}
+
 inline Vector3 operator+(Vector3 a, Vector3 b) {
 	return Vector3(a.x + b.x, a.y + b.y, a.z + b.z);
 }
@@ -201,8 +201,8 @@ void VQADecoder::decodeVideoFrame(Graphics::Surface *surface, int frame, bool fo
 	_videoTrack->decodeVideoFrame(surface, forceDraw);
 }
 
-void VQADecoder::decodeZBuffer(ZBuffer *zbuffer) {
-	_videoTrack->decodeZBuffer(zbuffer);
+VQADecoder::ZBufferUpdate VQADecoder::decodeZBuffer(ZBuffer *zbuffer) {
+	return _videoTrack->decodeZBuffer(zbuffer);
 }
 
 Audio::SeekableAudioStream *VQADecoder::decodeAudioFrame() {
@@ -603,8 +603,9 @@ VQADecoder::VQAVideoTrack::VQAVideoTrack(VQADecoder *vqaDecoder) {
 
 	_curFrame = -1;
 
-	_zbufChunkSize = 0;
-	_zbufChunk     = new uint8[roundup(_maxZBUFChunkSize)];
+	_zbufChunkSize    = 0;
+	_zbufChunk        = new uint8[roundup(_maxZBUFChunkSize)];
+	_zbufChunkDecoded = false;
 
 	_viewDataSize = 0;
 	_viewData     = nullptr;
@@ -710,17 +711,25 @@ bool VQADecoder::VQAVideoTrack::readZBUF(Common::SeekableReadStream *s, uint32 s
 	}
 
 	_zbufChunkSize = size;
+	_zbufChunkDecoded = false;
 	s->read(_zbufChunk, roundup(size));
 
 	return true;
 }
 
-void VQADecoder::VQAVideoTrack::decodeZBuffer(ZBuffer *zbuffer) {
+VQADecoder::ZBufferUpdate VQADecoder::VQAVideoTrack::decodeZBuffer(ZBuffer *zbuffer) {
 	if (_zbufChunkSize == 0) {
-		return;
+		return kZBufferUnchanged;
+	}
+
+	// Frames without a ZBUF chunk keep using the last one, there is no need
+	// to decompress it again
+	if (_zbufChunkDecoded) {
+		return zbuffer->restoreData(_zbufChunk, _zbufChunkSize) ? kZBufferRestored : kZBufferUnchanged;
 	}
 
-	zbuffer->decodeData(_zbufChunk, _zbufChunkSize);
+	_zbufChunkDecoded = zbuffer->decodeData(_zbufChunk, _zbufChunkSize);
+	return _zbufChunkDecoded ? kZBufferDecoded : kZBufferUnchanged;
 }
 
 bool VQADecoder::VQAVideoTrack::readVIEW(Common::SeekableReadStream *s, uint32 size) {
@@ -56,6 +56,12 @@ class VQADecoder {
 	friend class Debugger;
 
 public:
+	enum ZBufferUpdate {
+		kZBufferUnchanged, // No z-buffer chunk, or it could not be used
+		kZBufferDecoded,
+		kZBufferRestored   // Restored from the chunk decoded for an earlier frame
+	};
+
 	VQADecoder();
 	~VQADecoder();
 
@@ -64,7 +70,7 @@ public:
 	void readFrame(int frame, uint readFlags = kVQAReadAll);
 
 	void                        decodeVideoFrame(Graphics::Surface *surface, int frame, bool forceDraw = false);
-	void                        decodeZBuffer(ZBuffer *zbuffer);
+	ZBufferUpdate               decodeZBuffer(ZBuffer *zbuffer);
 	Audio::SeekableAudioStream *decodeAudioFrame();
 	void                        decodeView(View *view);
 	void                        decodeScreenEffects(ScreenEffects *aesc);
@@ -179,7 +185,7 @@ public:
 		int getFrameCount() const;
 
 		void decodeVideoFrame(Graphics::Surface *surface, bool forceDraw);
-		void decodeZBuffer(ZBuffer *zbuffer);
+		ZBufferUpdate decodeZBuffer(ZBuffer *zbuffer);
 		void decodeView(View *view);
 		void decodeScreenEffects(ScreenEffects *aesc);
 		void decodeLights(Lights *lights);
@@ -218,6 +224,7 @@ public:
 		uint8   *_cbfz;
 		uint32   _zbufChunkSize;
 		uint8   *_zbufChunk;
+		bool     _zbufChunkDecoded;
 
 		uint32   _vpointerSize;
 		uint8   *_vpointer;
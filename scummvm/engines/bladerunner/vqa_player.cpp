@@ -122,10 +122,21 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, bool useTime, Graphics:
 	} else if (useTime && (now < _frameNextTime)) {
 		result = -1;
 	} else if (advanceFrame) {
+		uint32 decodeStart = _vm->_system->getMillis();
+
 		_frame = _frameNext;
 		_decoder.readFrame(_frameNext, kVQAReadVideo);
 		_decoder.decodeVideoFrame(customSurface != nullptr ? customSurface : _surface, _frameNext);
 
+		uint32 decodeTime = _vm->_system->getMillis() - decodeStart;
+		_stats.framesDecoded += 1;
+		_stats.decodeTimeMs  += decodeTime;
+		_stats.maxDecodeTimeMs = MAX(_stats.maxDecodeTimeMs, decodeTime);
+		if (useTime && now >= _frameNextTime + 60000 / 15) {
+			// a whole frame behind schedule
+			_stats.framesLate += 1;
+		}
+
 		if (_hasAudio) {
 			int audioPreloadFrames = 14;
 			if (!_audioStarted) {
@@ -167,7 +178,16 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, bool useTime, Graphics:
 }
 
 void VQAPlayer::updateZBuffer(ZBuffer *zbuffer) {
-	_decoder.decodeZBuffer(zbuffer);
+	switch (_decoder.decodeZBuffer(zbuffer)) {
+	case VQADecoder::kZBufferDecoded:
+		_stats.zbuffersDecoded += 1;
+		break;
+	case VQADecoder::kZBufferRestored:
+		_stats.zbuffersSkipped += 1;
+		break;
+	default:
+		break;
+	}
 }
 
 void VQAPlayer::updateView(View *view) {
@@ -74,6 +74,28 @@ class VQAPlayer {
 	void (*_callbackLoopEnded)(void *, int frame, int loopId);
 	void  *_callbackData;
 
+	struct Stats {
+		uint32 framesDecoded;
+		uint32 framesLate;
+		uint32 zbuffersDecoded;
+		uint32 zbuffersSkipped;
+		uint32 decodeTimeMs;
+		uint32 maxDecodeTimeMs;
+
+		Stats() { reset(); }
+
+		void reset() {
+			framesDecoded    = 0;
+			framesLate       = 0;
+			zbuffersDecoded  = 0;
+			zbuffersSkipped = 0;
+			decodeTimeMs     = 0;
+			maxDecodeTimeMs  = 0;
+		}
+	};
+
+	Stats _stats;
+
 public:
 
 	VQAPlayer(BladeRunnerEngine *vm, Graphics::Surface *surface, const Common::String &name)
@@ -171,6 +171,24 @@ bool ZBuffer::decodeData(const uint8 *data, int size) {
 	return true;
 }
 
+bool ZBuffer::restoreData(const uint8 *data, int size) {
+	if (_disabled || size < 16) {
+		return false;
+	}
+
+	// Same as decoding the chunk again, as _zbuf1 still holds its content
+	// and only the parts overdrawn in _zbuf2 need to be restored
+	uint32 complete = READ_LE_UINT32(data + 8);
+	if (complete) {
+		resetUpdates();
+		memcpy(_zbuf2, _zbuf1, 2 * _width * _height);
+	} else {
+		clean();
+	}
+
+	return true;
+}
+
 uint16 *ZBuffer::getData() const {
 	return _zbuf2;
 }
@@ -64,6 +64,7 @@ public:
 
 	void init(int width, int height);
 	bool decodeData(const uint8 *data, int size);
+	bool restoreData(const uint8 *data, int size);
 
 	uint16 *getData() const;
 	uint16 getZValue(int x, int y) const;
@@ -23,6 +23,7 @@
 #include "base/version.h"
 
 #include "common/config-manager.h"
+#include "common/debug.h"
 #include "common/events.h"
 #include "common/str.h"
 #include "common/system.h"
@@ -229,7 +230,9 @@ void MainMenuDialog::save() {
 			result = _saveDialog->createDefaultSaveDescription(slot);
 		}
 
+		const uint32 saveStart = g_system->getMillis();
 		Common::Error status = _engine->saveGameState(slot, result);
+		debug(1, "Saving game to slot %d took %u ms", slot, g_system->getMillis() - saveStart);
 		if (status.getCode() != Common::kNoError) {
 			Common::String failMessage = Common::String::format(_("Failed to save game (%s)! "
 				  "Please consult the README for basic information, and for "
@@ -90,6 +90,15 @@ BitmapCast::BitmapCast(Common::ReadStreamEndian &stream, uint32 castTag, uint16
 	}
 	modified = 0;
 	tag = castTag;
+
+	surface = nullptr;
+	imgId = 0;
+	imgTag = 0;
+	sharedCast = false;
+	indexed = false;
+	img = nullptr;
+	decodedSize = 0;
+	lastUsed = 0;
 }
 
 TextCast::TextCast(Common::ReadStreamEndian &stream, uint16 version) {
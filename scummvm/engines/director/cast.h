@@ -28,6 +28,10 @@
 #include "director/archive.h"
 #include "graphics/surface.h"
 
+namespace Image {
+	class ImageDecoder;
+}
+
 namespace Director {
 
 class Stxt;
@@ -74,6 +78,16 @@ public:
 	uint16 bitsPerPixel;
 
 	uint32 tag;
+
+	// Image data location, decoded on first use by Score::getBitmapSurface()
+	uint16 imgId;
+	uint32 imgTag;
+	bool sharedCast;
+	bool indexed;
+
+	Image::ImageDecoder *img;
+	uint32 decodedSize;
+	uint32 lastUsed;
 };
 
 enum ShapeType {
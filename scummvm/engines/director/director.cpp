@@ -43,6 +43,7 @@ DirectorEngine::DirectorEngine(OSystem *syst, const DirectorGameDescription *gam
 	DebugMan.addDebugChannel(kDebugLingoExec, "lingoexec", "Lingo Execution");
 	DebugMan.addDebugChannel(kDebugLingoCompile, "lingocompile", "Lingo Compilation");
 	DebugMan.addDebugChannel(kDebugLingoParse, "lingoparse", "Lingo code parsing");
+	DebugMan.addDebugChannel(kDebugLingoProfile, "lingoprofile", "Lingo handler profiling");
 	DebugMan.addDebugChannel(kDebugLoading, "loading", "Loading");
 	DebugMan.addDebugChannel(kDebugImages, "images", "Image drawing");
 	DebugMan.addDebugChannel(kDebugText, "text", "Text rendering");
@@ -173,7 +174,12 @@ Common::Error DirectorEngine::run() {
 	while (loop) {
 		loop = false;
 
+		uint32 loadStart = g_system->getMillis();
+
 		_currentScore->loadArchive();
+		_lingo->pruneCompiledScripts();
+
+		debugC(1, kDebugLoading, "Loaded score '%s' in %d ms", _currentScore->getMacName().c_str(), g_system->getMillis() - loadStart);
 
 		// If we came in a loop, then skip as requested
 		if (!_nextMovie.frameS.empty()) {
@@ -192,6 +198,9 @@ Common::Error DirectorEngine::run() {
 
 		debugC(1, kDebugEvents, "Finished playback of score '%s'", _currentScore->getMacName().c_str());
 
+		if (debugChannelSet(-1, kDebugLingoProfile))
+			_lingo->dumpHandlerProfile();
+
 		// If a loop was requested, do it
 		if (!_nextMovie.movie.empty()) {
 			_lingo->restartLingo();
@@ -62,7 +62,8 @@ enum {
 	kDebugImages		= 1 << 3,
 	kDebugText			= 1 << 4,
 	kDebugEvents		= 1 << 5,
-	kDebugLingoParse	= 1 << 6
+	kDebugLingoParse	= 1 << 6,
+	kDebugLingoProfile	= 1 << 7
 };
 
 struct MovieReference {
@@ -403,19 +403,160 @@ void Frame::readSprite(Common::SeekableSubReadStreamEndian &stream, uint16 offse
 }
 
 void Frame::prepareFrame(Score *score) {
+	Common::Array<ChannelState> states;
+
+	states.resize(CHANNEL_COUNT);
+
+	for (uint16 i = 0; i < CHANNEL_COUNT; i++)
+		states[i] = getChannelState(score, i);
+
 	_drawRects.clear();
-	renderSprites(*score->_surface, false);
+	_channelBounds.clear();
+	_channelBounds.resize(CHANNEL_COUNT);
+
+	Common::Rect dirtyRect = composeStage(score, states);
+
+	for (uint dr = 0; dr < _drawRects.size(); dr++)
+		states[_drawRects[dr]->spriteId].drawRects.push_back(_drawRects[dr]->rect);
+
 	renderSprites(*score->_trailSurface, true);
 
-	if (_transType != 0)
+	for (uint16 i = 0; i < CHANNEL_COUNT; i++)
+		states[i].bounds = _channelBounds[i];
+
+	score->_channelStates = states;
+
+	if (_transType != 0) {
 		// TODO Handle changing area case
 		playTransition(score);
 
+		// Transitions draw the stage piecewise, so the screen may hold anything
+		dirtyRect = score->_surface->getBounds();
+	}
+
 	if (_sound1 != 0 || _sound2 != 0) {
 		playSoundChannel();
 	}
 
-	g_system->copyRectToScreen(score->_surface->getPixels(), score->_surface->pitch, 0, 0, score->_surface->getBounds().width(), score->_surface->getBounds().height());
+	if (!dirtyRect.isEmpty())
+		g_system->copyRectToScreen(score->_surface->getBasePtr(dirtyRect.left, dirtyRect.top), score->_surface->pitch,
+			dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+}
+
+ChannelState Frame::getChannelState(Score *score, uint16 spriteId) {
+	Sprite *sprite = _sprites[spriteId];
+	ChannelState state;
+
+	state.enabled = sprite->_enabled;
+	state.castId = sprite->_castId;
+	state.ink = sprite->_ink;
+	state.trails = sprite->_trails;
+	state.spriteType = sprite->_spriteType;
+	state.startPoint = sprite->_startPoint;
+	state.width = sprite->_width;
+	state.height = sprite->_height;
+	state.foreColor = sprite->_foreColor;
+	state.backColor = sprite->_backColor;
+	state.lineSize = sprite->_lineSize;
+	state.mouseDown = (score->_currentMouseDownSpriteId == spriteId);
+	state.cast = sprite->_bitmapCast;
+	// Text may be edited and trails are only seen on the next frame,
+	// so these are always taken as changed
+	state.volatileContent = sprite->_textCast || sprite->_buttonCast || sprite->_trails;
+
+	return state;
+}
+
+static void extendDirtyRect(Common::Rect &dirtyRect, Common::Rect rect, const Common::Rect &stageRect) {
+	rect.clip(stageRect);
+
+	if (rect.isEmpty())
+		return;
+
+	if (dirtyRect.isEmpty())
+		dirtyRect = rect;
+	else
+		dirtyRect.extend(rect);
+}
+
+Common::Rect Frame::composeStage(Score *score, const Common::Array<ChannelState> &states) {
+	Common::Rect stageRect = score->_surface->getBounds();
+	Common::Rect dirtyRect;
+	Common::Array<bool> changed;
+
+	if (score->_channelStates.size() != CHANNEL_COUNT) {
+		score->_channelStates.clear();
+		score->_channelStates.resize(CHANNEL_COUNT);
+		score->_fullRedraw = true;
+	}
+
+	changed.resize(CHANNEL_COUNT);
+
+	for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
+		const ChannelState &prevState = score->_channelStates[i];
+
+		changed[i] = !states[i].sameSprite(prevState) || states[i].volatileContent || prevState.volatileContent;
+
+		if (changed[i]) {
+			extendDirtyRect(dirtyRect, prevState.bounds, stageRect);
+			extendDirtyRect(dirtyRect, predictSpriteRect(i), stageRect);
+		}
+	}
+
+	if (score->_fullRedraw) {
+		dirtyRect = stageRect;
+		score->_fullRedraw = false;
+	}
+
+	// Text and buttons are only measured while drawing them, so when a changed
+	// channel ends up outside of the dirty area, grow it and compose again
+	for (;;) {
+		_drawRects.clear();
+		_channelBounds.clear();
+		_channelBounds.resize(CHANNEL_COUNT);
+
+		if (!dirtyRect.isEmpty())
+			score->_composeSurface->copyRectToSurface(*score->_trailSurface, dirtyRect.left, dirtyRect.top, dirtyRect);
+
+		for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
+			if (!_sprites[i]->_enabled || _sprites[i]->_trails == 1)
+				continue;
+
+			const ChannelState &prevState = score->_channelStates[i];
+
+			if (changed[i] || (!prevState.bounds.isEmpty() && prevState.bounds.intersects(dirtyRect))) {
+				renderSprite(*score->_composeSurface, i);
+			} else {
+				// Untouched by this frame, so keep what it registered last time
+				for (uint dr = 0; dr < prevState.drawRects.size(); dr++) {
+					FrameEntity *fi = new FrameEntity();
+					fi->spriteId = i;
+					fi->rect = prevState.drawRects[dr];
+					_drawRects.push_back(fi);
+				}
+				_channelBounds[i] = prevState.bounds;
+			}
+		}
+
+		Common::Rect grownRect = dirtyRect;
+
+		for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
+			if (changed[i])
+				extendDirtyRect(grownRect, _channelBounds[i], stageRect);
+		}
+
+		if (grownRect == dirtyRect)
+			break;
+
+		dirtyRect = grownRect;
+	}
+
+	if (!dirtyRect.isEmpty())
+		score->_surface->copyRectToSurface(*score->_composeSurface, dirtyRect.left, dirtyRect.top, dirtyRect);
+
+	debugC(3, kDebugImages, "Frame::composeStage(): dirty %d,%d %dx%d", dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+
+	return dirtyRect;
 }
 
 void Frame::playSoundChannel() {
@@ -572,65 +713,113 @@ void Frame::renderSprites(Graphics::ManagedSurface &surface, bool renderTrail) {
 			if ((_sprites[i]->_trails == 0 && renderTrail) || (_sprites[i]->_trails == 1 && !renderTrail))
 				continue;
 
-			CastType castType = kCastTypeNull;
-			if (_vm->getVersion() < 4) {
-				debugC(1, kDebugImages, "Channel: %d type: %d", i, _sprites[i]->_spriteType);
-				switch (_sprites[i]->_spriteType) {
-				case 1:
-					castType = kCastBitmap;
-					break;
-				case 2:
-				case 12: // this is actually a mouse-over shape? I don't think it's a real button.
-				case 16: // Face kit D3
-					castType = kCastShape;
-					break;
-				case 7:
-					castType = kCastText;
-					break;
-				}
+			renderSprite(surface, i);
+		}
+	}
+}
+
+bool Frame::getSpriteCastType(uint16 spriteId, CastType &castType) {
+	castType = kCastTypeNull;
+
+	if (_vm->getVersion() < 4) {
+		debugC(1, kDebugImages, "Channel: %d type: %d", spriteId, _sprites[spriteId]->_spriteType);
+		switch (_sprites[spriteId]->_spriteType) {
+		case 1:
+			castType = kCastBitmap;
+			break;
+		case 2:
+		case 12: // this is actually a mouse-over shape? I don't think it's a real button.
+		case 16: // Face kit D3
+			castType = kCastShape;
+			break;
+		case 7:
+			castType = kCastText;
+			break;
+		}
+	} else {
+		if (!_vm->getCurrentScore()->_castTypes.contains(_sprites[spriteId]->_castId)) {
+			if (!_vm->getSharedCastTypes()->contains(_sprites[spriteId]->_castId)) {
+				warning("Cast id %d not found", _sprites[spriteId]->_castId);
+				return false;
 			} else {
-				if (!_vm->getCurrentScore()->_castTypes.contains(_sprites[i]->_castId)) {
-					if (!_vm->getSharedCastTypes()->contains(_sprites[i]->_castId)) {
-						warning("Cast id %d not found", _sprites[i]->_castId);
-						continue;
-					} else {
-						warning("Getting cast id %d from shared cast", _sprites[i]->_castId);
-						castType = _vm->getSharedCastTypes()->getVal(_sprites[i]->_castId);
-					}
-				} else {
-					castType = _vm->getCurrentScore()->_castTypes[_sprites[i]->_castId];
-				}
+				warning("Getting cast id %d from shared cast", _sprites[spriteId]->_castId);
+				castType = _vm->getSharedCastTypes()->getVal(_sprites[spriteId]->_castId);
 			}
+		} else {
+			castType = _vm->getCurrentScore()->_castTypes[_sprites[spriteId]->_castId];
+		}
+	}
 
-			// this needs precedence to be hit first... D3 does something really tricky with cast IDs for shapes.
-			// I don't like this implementation 100% as the 'cast' above might not actually hit a member and be null?
-			if (castType == kCastShape) {
-				renderShape(surface, i);
-			} else if (castType == kCastText || castType == kCastRTE) {
-				renderText(surface, i, NULL);
-			} else if (castType == kCastButton) {
-				renderButton(surface, i);
-			} else {
-				if (!_sprites[i]->_bitmapCast) {
-					warning("No cast ID for sprite %d", i);
-					continue;
-				}
+	return true;
+}
 
-				uint32 regX = _sprites[i]->_bitmapCast->regX;
-				uint32 regY = _sprites[i]->_bitmapCast->regY;
-				uint32 rectLeft = _sprites[i]->_bitmapCast->initialRect.left;
-				uint32 rectTop = _sprites[i]->_bitmapCast->initialRect.top;
+Common::Rect Frame::getBitmapDrawRect(uint16 spriteId) {
+	uint32 regX = _sprites[spriteId]->_bitmapCast->regX;
+	uint32 regY = _sprites[spriteId]->_bitmapCast->regY;
+	uint32 rectLeft = _sprites[spriteId]->_bitmapCast->initialRect.left;
+	uint32 rectTop = _sprites[spriteId]->_bitmapCast->initialRect.top;
 
-				int x = _sprites[i]->_startPoint.x - regX + rectLeft;
-				int y = _sprites[i]->_startPoint.y - regY + rectTop;
-				int height = _sprites[i]->_height;
-				int width = _vm->getVersion() > 4 ? _sprites[i]->_bitmapCast->initialRect.width() : _sprites[i]->_width;
+	int x = _sprites[spriteId]->_startPoint.x - regX + rectLeft;
+	int y = _sprites[spriteId]->_startPoint.y - regY + rectTop;
+	int height = _sprites[spriteId]->_height;
+	int width = _vm->getVersion() > 4 ? _sprites[spriteId]->_bitmapCast->initialRect.width() : _sprites[spriteId]->_width;
 
-				Common::Rect drawRect(x, y, x + width, y + height);
-				addDrawRect(i, drawRect);
-				inkBasedBlit(surface, *(_sprites[i]->_bitmapCast->surface), i, drawRect);
-			}
+	return Common::Rect(x, y, x + width, y + height);
+}
+
+Common::Rect Frame::getShapeRect(uint16 spriteId) {
+	return Common::Rect(_sprites[spriteId]->_startPoint.x,
+		_sprites[spriteId]->_startPoint.y,
+		_sprites[spriteId]->_startPoint.x + _sprites[spriteId]->_width,
+		_sprites[spriteId]->_startPoint.y + _sprites[spriteId]->_height);
+}
+
+Common::Rect Frame::predictSpriteRect(uint16 spriteId) {
+	// Where the sprite will be drawn on the stage, when that is known without drawing it.
+	// Trails only reach the stage through the trail surface on the next frame.
+	CastType castType;
+
+	if (!_sprites[spriteId]->_enabled || _sprites[spriteId]->_trails == 1 || !getSpriteCastType(spriteId, castType))
+		return Common::Rect();
+
+	if (castType == kCastShape)
+		return getShapeRect(spriteId);
+
+	if (castType == kCastText || castType == kCastRTE || castType == kCastButton || !_sprites[spriteId]->_bitmapCast)
+		return Common::Rect();
+
+	return getBitmapDrawRect(spriteId);
+}
+
+void Frame::renderSprite(Graphics::ManagedSurface &surface, uint16 spriteId) {
+	CastType castType;
+
+	if (!getSpriteCastType(spriteId, castType))
+		return;
+
+	// this needs precedence to be hit first... D3 does something really tricky with cast IDs for shapes.
+	// I don't like this implementation 100% as the 'cast' above might not actually hit a member and be null?
+	if (castType == kCastShape) {
+		renderShape(surface, spriteId);
+	} else if (castType == kCastText || castType == kCastRTE) {
+		renderText(surface, spriteId, NULL);
+	} else if (castType == kCastButton) {
+		renderButton(surface, spriteId);
+	} else {
+		if (!_sprites[spriteId]->_bitmapCast) {
+			warning("No cast ID for sprite %d", spriteId);
+			return;
 		}
+
+		Common::Rect drawRect = getBitmapDrawRect(spriteId);
+		addDrawRect(spriteId, drawRect);
+
+		BitmapCast *bitmapCast = _sprites[spriteId]->_bitmapCast;
+		Score *owner = (bitmapCast->sharedCast && _vm->getSharedScore()) ? _vm->getSharedScore() : _vm->getCurrentScore();
+		const Graphics::Surface *bitmap = owner->getBitmapSurface(bitmapCast);
+
+		if (bitmap)
+			inkBasedBlit(surface, *bitmap, spriteId, drawRect);
 	}
 }
 
@@ -639,13 +828,22 @@ void Frame::addDrawRect(uint16 spriteId, Common::Rect &rect) {
 	fi->spriteId = spriteId;
 	fi->rect = rect;
 	_drawRects.push_back(fi);
+
+	extendChannelBounds(spriteId, rect);
+}
+
+void Frame::extendChannelBounds(uint16 spriteId, const Common::Rect &rect) {
+	if (spriteId >= _channelBounds.size() || rect.isEmpty())
+		return;
+
+	if (_channelBounds[spriteId].isEmpty())
+		_channelBounds[spriteId] = rect;
+	else
+		_channelBounds[spriteId].extend(rect);
 }
 
 void Frame::renderShape(Graphics::ManagedSurface &surface, uint16 spriteId) {
-	Common::Rect shapeRect = Common::Rect(_sprites[spriteId]->_startPoint.x,
-		_sprites[spriteId]->_startPoint.y,
-		_sprites[spriteId]->_startPoint.x + _sprites[spriteId]->_width,
-		_sprites[spriteId]->_startPoint.y + _sprites[spriteId]->_height);
+	Common::Rect shapeRect = getShapeRect(spriteId);
 
 	Graphics::ManagedSurface tmpSurface;
 	tmpSurface.create(shapeRect.width(), shapeRect.height(), Graphics::PixelFormat::createFormatCLUT8());
@@ -712,6 +910,8 @@ void Frame::renderButton(Graphics::ManagedSurface &surface, uint16 spriteId) {
 }
 
 void Frame::inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics::Surface &spriteSurface, uint16 spriteId, Common::Rect drawRect) {
+	extendChannelBounds(spriteId, drawRect);
+
 	switch (_sprites[spriteId]->_ink) {
 	case kInkTypeCopy:
 		targetSurface.blitFrom(spriteSurface, Common::Point(drawRect.left, drawRect.top));
@@ -724,7 +924,7 @@ void Frame::inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics
 		drawBackgndTransSprite(targetSurface, spriteSurface, drawRect);
 		break;
 	case kInkTypeMatte:
-		drawMatteSprite(targetSurface, spriteSurface, drawRect);
+		drawMatteSprite(targetSurface, spriteSurface, drawRect, spriteId);
 		break;
 	case kInkTypeGhost:
 		drawGhostSprite(targetSurface, spriteSurface, drawRect);
@@ -878,100 +1078,167 @@ void Frame::drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graph
 	}
 }
 
+const byte *Frame::getCoverageRow(int x, int y, int width) {
+	// Same answer as getSpriteIDFromPos(Common::Point(x + i, y)) != 0, but for
+	// a whole row at once: later rects are on top, so they overwrite earlier ones
+	_coverageRow.resize(MAX(width, 1));
+	byte *covered = _coverageRow.begin();
+
+	memset(covered, 0, width);
+
+	for (uint dr = 0; dr < _drawRects.size(); dr++) {
+		const Common::Rect &rect = _drawRects[dr]->rect;
+
+		if (y < rect.top || y >= rect.bottom)
+			continue;
+
+		int from = MAX<int>(rect.left, x) - x;
+		int to = MIN<int>(rect.right, x + width) - x;
+
+		if (from < to)
+			memset(covered + from, _drawRects[dr]->spriteId != 0 ? 1 : 0, to - from);
+	}
+
+	return covered;
+}
+
 void Frame::drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1;
+	int width = drawRect.width();
+
 	for (int ii = 0; ii < sprite.h; ii++) {
 		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
 		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
+		const byte *covered = getCoverageRow(drawRect.left, drawRect.top + ii, width);
 
-		for (int j = 0; j < drawRect.width(); j++) {
-			if ((getSpriteIDFromPos(Common::Point(drawRect.left + j, drawRect.top + ii)) != 0) && (*src != skipColor))
-				*dst = (_vm->getPaletteColorCount() - 1) - *src; // Oposite color
-
-			src++;
-			dst++;
+		for (int j = 0; j < width; j++) {
+			if (covered[j] && src[j] != skipColor)
+				dst[j] = skipColor - src[j]; // Oposite color
 		}
 	}
 }
 
 void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1;
+	int width = drawRect.width();
+
 	for (int ii = 0; ii < sprite.h; ii++) {
 		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
 		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
+		const byte *covered = getCoverageRow(drawRect.left, drawRect.top + ii, width);
 
-		for (int j = 0; j < drawRect.width(); j++) {
-			if ((getSpriteIDFromPos(Common::Point(drawRect.left + j, drawRect.top + ii)) != 0)) {
-				if (*src != skipColor) {
-					*dst = (*dst == *src ? (*src == 0 ? 0xff : 0) : *src);
-				}
-			} else if (*src != skipColor) {
-				*dst = *src;
-			}
-			src++;
-			dst++;
+		for (int j = 0; j < width; j++) {
+			if (src[j] == skipColor)
+				continue;
+
+			if (covered[j])
+				dst[j] = (dst[j] == src[j] ? (src[j] == 0 ? 0xff : 0) : src[j]);
+			else
+				dst[j] = src[j];
 		}
 	}
 }
 
-void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
-	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels are transparent
-	Graphics::Surface tmp;
-	tmp.copyFrom(sprite);
-
+int Frame::findMatteWhiteColor(const Graphics::Surface &sprite) {
 	// Searching white color in the corners
-	int whiteColor = -1;
-
 	for (int corner = 0; corner < 4; corner++) {
-		int x = (corner & 0x1) ? tmp.w - 1 : 0;
-		int y = (corner & 0x2) ? tmp.h - 1 : 0;
+		int x = (corner & 0x1) ? sprite.w - 1 : 0;
+		int y = (corner & 0x2) ? sprite.h - 1 : 0;
 
-		byte color = *(byte *)tmp.getBasePtr(x, y);
+		byte color = *(const byte *)sprite.getBasePtr(x, y);
 
 		if (_vm->getPalette()[color * 3 + 0] == 0xff &&
 			_vm->getPalette()[color * 3 + 1] == 0xff &&
 			_vm->getPalette()[color * 3 + 2] == 0xff) {
-			whiteColor = color;
-			break;
+			return color;
 		}
 	}
 
+	return -1;
+}
+
+void Frame::buildMatteMask(const Graphics::Surface &sprite, int whiteColor, MatteMask &matte) {
+	matte.whiteColor = whiteColor;
+
 	if (whiteColor == -1) {
 		debugC(1, kDebugImages, "No white color for Matte image");
+		return;
+	}
+
+	Graphics::Surface tmp;
+	tmp.copyFrom(sprite);
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
-			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+	Graphics::FloodFill ff(&tmp, whiteColor, 0, true);
 
-			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++)
-				*dst = *src;
-		}
+	for (int yy = 0; yy < tmp.h; yy++) {
+		ff.addSeed(0, yy);
+		ff.addSeed(tmp.w - 1, yy);
+	}
+
+	for (int xx = 0; xx < tmp.w; xx++) {
+		ff.addSeed(xx, 0);
+		ff.addSeed(xx, tmp.h - 1);
+	}
+	ff.fillMask();
+
+	matte.mask.copyFrom(*ff.getMask());
+	tmp.free();
+}
+
+MatteMask *Frame::getCachedMatteMask(const Graphics::Surface &sprite, int whiteColor) {
+	Score *score = _vm->getCurrentScore();
+	MatteMask *matte;
+
+	if (score->_matteMasks.contains(&sprite)) {
+		matte = score->_matteMasks[&sprite];
+
+		// The palette may have changed which entry is white
+		if (matte->whiteColor == whiteColor)
+			return matte;
+
+		matte->mask.free();
 	} else {
-		Graphics::FloodFill ff(&tmp, whiteColor, 0, true);
+		// Owned by the score, which frees it with the surface or on destruction
+		matte = new MatteMask;
+		score->_matteMasks[&sprite] = matte;
+	}
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			ff.addSeed(0, yy);
-			ff.addSeed(tmp.w - 1, yy);
-		}
+	buildMatteMask(sprite, whiteColor, *matte);
 
-		for (int xx = 0; xx < tmp.w; xx++) {
-			ff.addSeed(xx, 0);
-			ff.addSeed(xx, tmp.h - 1);
+	return matte;
+}
+
+void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect, uint16 spriteId) {
+	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels are transparent.
+	// Bitmap casts do not change, so their masks are kept around instead of flood filling every frame
+	bool cacheable = _sprites[spriteId]->_bitmapCast && _sprites[spriteId]->_bitmapCast->surface == &sprite;
+	int whiteColor = findMatteWhiteColor(sprite);
+	MatteMask uncachedMatte;
+	MatteMask *matte = &uncachedMatte;
+	int width = drawRect.width();
+
+	if (cacheable)
+		matte = getCachedMatteMask(sprite, whiteColor);
+	else
+		buildMatteMask(sprite, whiteColor, uncachedMatte);
+
+	for (int yy = 0; yy < sprite.h; yy++) {
+		const byte *src = (const byte *)sprite.getBasePtr(0, yy);
+		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+
+		if (matte->whiteColor == -1) {
+			memcpy(dst, src, width);
+			continue;
 		}
-		ff.fillMask();
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
-			const byte *mask = (const byte *)ff.getMask()->getBasePtr(0, yy);
-			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+		const byte *mask = (const byte *)matte->mask.getBasePtr(0, yy);
 
-			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++, mask++)
-				if (*mask == 0)
-					*dst = *src;
-		}
+		for (int xx = 0; xx < width; xx++)
+			if (mask[xx] == 0)
+				dst[xx] = src[xx];
 	}
 
-	tmp.free();
+	uncachedMatte.mask.free();
 }
 
 uint16 Frame::getSpriteIDFromPos(Common::Point pos) {
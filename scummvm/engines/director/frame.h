@@ -32,6 +32,8 @@ namespace Image {
 namespace Director {
 
 class Sprite;
+struct ChannelState;
+struct MatteMask;
 
 enum {
 	kChannelDataSize = (25 * 50)
@@ -125,6 +127,11 @@ private:
 	void playTransition(Score *score);
 	void playSoundChannel();
 	void renderSprites(Graphics::ManagedSurface &surface, bool renderTrail);
+	void renderSprite(Graphics::ManagedSurface &surface, uint16 spriteId);
+	bool getSpriteCastType(uint16 spriteId, CastType &castType);
+	Common::Rect getBitmapDrawRect(uint16 spriteId);
+	Common::Rect getShapeRect(uint16 spriteId);
+	Common::Rect predictSpriteRect(uint16 spriteId);
 	void renderText(Graphics::ManagedSurface &surface, uint16 spriteId, Common::Rect *textSize);
 	void renderShape(Graphics::ManagedSurface &surface, uint16 spriteId);
 	void renderButton(Graphics::ManagedSurface &surface, uint16 spriteId);
@@ -134,11 +141,18 @@ private:
 	Image::ImageDecoder *getImageFrom(uint16 spriteId);
 	Common::String readTextStream(Common::SeekableSubReadStreamEndian *textStream, TextCast *textCast);
 	void drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
-	void drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
+	void drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect, uint16 spriteId);
+	int findMatteWhiteColor(const Graphics::Surface &sprite);
+	void buildMatteMask(const Graphics::Surface &sprite, int whiteColor, MatteMask &matte);
+	MatteMask *getCachedMatteMask(const Graphics::Surface &sprite, int whiteColor);
 	void drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
 	void drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
 	void inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics::Surface &spriteSurface, uint16 spriteId, Common::Rect drawRect);
 	void addDrawRect(uint16 entityId, Common::Rect &rect);
+	void extendChannelBounds(uint16 spriteId, const Common::Rect &rect);
+	const byte *getCoverageRow(int x, int y, int width);
+	ChannelState getChannelState(Score *score, uint16 spriteId);
+	Common::Rect composeStage(Score *score, const Common::Array<ChannelState> &states);
 
 public:
 	byte _channelData[kChannelDataSize];
@@ -159,6 +173,8 @@ public:
 	uint8 _blend;
 	Common::Array<Sprite *> _sprites;
 	Common::Array<FrameEntity *> _drawRects;
+	Common::Array<Common::Rect> _channelBounds;
+	Common::Array<byte> _coverageRow;
 	DirectorEngine *_vm;
 };
 
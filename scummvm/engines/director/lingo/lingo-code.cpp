@@ -43,6 +43,8 @@
 // ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
 // THIS SOFTWARE.
 
+#include "common/system.h"
+
 #include "director/cast.h"
 #include "director/util.h"
 #include "director/lingo/lingo.h"
@@ -1073,6 +1075,9 @@ void Lingo::call(Common::String name, int nargs) {
 			g_lingo->pop();
 	}
 
+	bool profiling = debugChannelSet(-1, kDebugLingoProfile);
+	uint32 startTime = profiling ? g_system->getMillis() : 0;
+
 	if (sym->type == BLTIN || sym->type == FBLTIN || sym->type == RBLTIN) {
 		if (sym->u.bltin == b_factory) {
 			g_lingo->factoryCall(name, nargs);
@@ -1081,6 +1086,9 @@ void Lingo::call(Common::String name, int nargs) {
 
 			(*sym->u.bltin)(nargs);
 
+			if (profiling)
+				profileHandler(name, startTime);
+
 			int stackNewSize = _stack.size();
 
 			if (sym->type == FBLTIN || sym->type == RBLTIN) {
@@ -1120,6 +1128,9 @@ void Lingo::call(Common::String name, int nargs) {
 	g_lingo->execute(0);
 
 	g_lingo->_returning = false;
+
+	if (profiling)
+		profileHandler(name, startTime);
 }
 
 void Lingo::c_procret() {
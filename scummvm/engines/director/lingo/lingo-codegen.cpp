@@ -238,6 +238,9 @@ void Lingo::define(Common::String &name, int start, int nargs, Common::String *p
 	sym->u.defn = new ScriptData(&(*_currentScript)[start], end - start + 1);
 	sym->nargs = nargs;
 	sym->maxArgs = nargs;
+	sym->generation = ++_definitionGeneration;
+
+	addDefinition(name, sym);
 }
 
 int Lingo::codeString(const char *str) {
@@ -398,8 +401,11 @@ void Lingo::codeFactory(Common::String &name) {
 	sym->maxArgs = 0;
 	sym->parens = true;
 	sym->u.bltin = g_lingo->b_factory;
+	sym->generation = ++_definitionGeneration;
 
 	_handlers[ENTITY_INDEX(_eventHandlerTypeIds[name.c_str()], _currentEntityId)] = sym;
+
+	addDefinition(name, sym);
 }
 
 }
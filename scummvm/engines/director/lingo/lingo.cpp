@@ -20,9 +20,12 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/archive.h"
 #include "common/file.h"
+#include "common/hash-str.h"
 #include "common/str-array.h"
+#include "common/system.h"
 
 #include "director/lingo/lingo.h"
 #include "director/lingo/lingo-gr.h"
@@ -40,6 +43,7 @@ Symbol::Symbol() {
 	maxArgs = 0;
 	parens = true;
 	global = false;
+	generation = 0;
 }
 
 Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
@@ -69,6 +73,9 @@ Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 
 	_localvars = NULL;
 
+	_compilingScript = NULL;
+	_definitionGeneration = 0;
+
 	initEventHandlerTypes();
 
 	initBuiltIns();
@@ -79,6 +86,8 @@ Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 }
 
 Lingo::~Lingo() {
+	for (CompiledScriptHash::iterator it = _compiledScripts.begin(); it != _compiledScripts.end(); ++it)
+		delete it->_value;
 }
 
 const char *Lingo::findNextDefinition(const char *s) {
@@ -123,8 +132,16 @@ void Lingo::addCode(const char *code, ScriptType type, uint16 id) {
 
 	if (_scripts[type].contains(id)) {
 		delete _scripts[type][id];
+		_scripts[type].erase(id);
 	}
 
+	// Movies sharing scripts, or the same movie being loaded again, would
+	// otherwise run the whole parser again for every cast member
+	Common::String key = Common::String::format("%d:%d:%08x", type, id, Common::hashit(code));
+
+	if (reuseCompiledScript(key, code, type, id))
+		return;
+
 	_currentScript = new ScriptData;
 	_currentScriptType = type;
 	_scripts[type][id] = _currentScript;
@@ -142,6 +159,14 @@ void Lingo::addCode(const char *code, ScriptType type, uint16 id) {
 		return;
 	}
 
+	if (_compiledScripts.contains(key))
+		delete _compiledScripts[key];
+
+	_compilingScript = new CompiledScript;
+	_compilingScript->code = code;
+	_compilingScript->used = true;
+	_compiledScripts[key] = _compilingScript;
+
 	// macros and factories have conflicting grammar. Thus we ease life for the parser.
 	if ((begin = findNextDefinition(code))) {
 		bool first = true;
@@ -190,6 +215,10 @@ void Lingo::addCode(const char *code, ScriptType type, uint16 id) {
 
 	_inFactory = false;
 
+	_compilingScript->script = *_currentScript;
+	_compilingScript->hadError = _hadError;
+	_compilingScript = NULL;
+
 	if (debugChannelSet(3, kDebugLingoCompile)) {
 		if (_currentScript->size() && !_hadError)
 			Common::hexdump((byte *)&_currentScript->front(), _currentScript->size() * sizeof(inst));
@@ -202,6 +231,95 @@ void Lingo::addCode(const char *code, ScriptType type, uint16 id) {
 	}
 }
 
+bool Lingo::reuseCompiledScript(const Common::String &key, const char *code, ScriptType type, uint16 id) {
+	if (!_compiledScripts.contains(key))
+		return false;
+
+	CompiledScript *compiled = _compiledScripts[key];
+
+	// The key only holds a hash of the code, so make sure it is the same
+	if (compiled->code != code)
+		return false;
+
+	// The handlers defined by the script must still be the ones it compiled,
+	// otherwise another script redefined them and we have to parse again.
+	// Compare generations rather than pointers, as a redefinition may well
+	// get the address of the definition it replaced.
+	_currentEntityId = id;
+	for (uint i = 0; i < compiled->definitions.size(); i++) {
+		CompiledDefinition &def = compiled->definitions[i];
+		Symbol *sym = getHandler(def.name);
+
+		if (!sym || sym->generation != def.generation)
+			return false;
+	}
+
+	debugC(1, kDebugLingoCompile, "Reusing compiled code for type %s with id %d", scriptType2str(type), id);
+
+	_currentScript = new ScriptData(compiled->script);
+	_currentScriptType = type;
+	_scripts[type][id] = _currentScript;
+	_hadError = compiled->hadError;
+	compiled->used = true;
+
+	return true;
+}
+
+void Lingo::pruneCompiledScripts() {
+	for (CompiledScriptHash::iterator it = _compiledScripts.begin(); it != _compiledScripts.end(); ++it) {
+		if (it->_value->used) {
+			it->_value->used = false;
+		} else {
+			delete it->_value;
+			_compiledScripts.erase(it);
+		}
+	}
+}
+
+void Lingo::addDefinition(Common::String &name, Symbol *sym) {
+	if (!_compilingScript)
+		return;
+
+	CompiledDefinition def;
+	def.name = name;
+	def.generation = sym->generation;
+
+	_compilingScript->definitions.push_back(def);
+}
+
+void Lingo::profileHandler(const Common::String &name, uint32 startTime) {
+	uint32 time = g_system->getMillis() - startTime;
+	HandlerProfile &profile = _handlerProfiles[name];
+
+	profile.calls++;
+	profile.totalTime += time;
+	profile.maxTime = MAX(profile.maxTime, time);
+}
+
+static bool handlerProfileLess(const Common::HashMap<Common::String, HandlerProfile>::const_iterator &a,
+								const Common::HashMap<Common::String, HandlerProfile>::const_iterator &b) {
+	return a->_value.totalTime > b->_value.totalTime;
+}
+
+void Lingo::dumpHandlerProfile() {
+	if (_handlerProfiles.empty())
+		return;
+
+	Common::Array<Common::HashMap<Common::String, HandlerProfile>::const_iterator> entries;
+	for (Common::HashMap<Common::String, HandlerProfile>::const_iterator it = _handlerProfiles.begin(); it != _handlerProfiles.end(); ++it)
+		entries.push_back(it);
+
+	Common::sort(entries.begin(), entries.end(), handlerProfileLess);
+
+	debugC(1, kDebugLingoProfile, "Handler profile (calls, total ms, max ms):");
+	for (uint i = 0; i < entries.size(); i++) {
+		const HandlerProfile &profile = entries[i]->_value;
+		debugC(1, kDebugLingoProfile, "  %-32s %6u %8u %6u", entries[i]->_key.c_str(), profile.calls, profile.totalTime, profile.maxTime);
+	}
+
+	_handlerProfiles.clear();
+}
+
 void Lingo::executeScript(ScriptType type, uint16 id) {
 	if (!_scripts[type].contains(id)) {
 		debugC(3, kDebugLingoExec, "Request to execute non-existant script type %d id %d", type, id);
@@ -106,6 +106,7 @@ struct Symbol {	/* symbol table entry */
 	bool parens;	/* whether parens required or not, for builitins */
 
 	bool global;
+	uint32 generation;	/* unique id of the current definition, see Lingo::define() */
 
 	Symbol();
 };
@@ -141,6 +142,29 @@ struct Builtin {
 };
 
 typedef Common::HashMap<int32, ScriptData *> ScriptHash;
+
+struct CompiledDefinition {	/* handler or factory defined by a compiled script */
+	Common::String name;
+	uint32 generation;
+};
+
+struct CompiledScript {	/* compilation result kept across movie loads */
+	Common::String code;	/* source, to tell apart scripts with the same key */
+	ScriptData script;
+	Common::Array<CompiledDefinition> definitions;
+	bool hadError;
+	bool used;	/* compiled or reused by the current movie */
+};
+
+typedef Common::HashMap<Common::String, CompiledScript *> CompiledScriptHash;
+
+struct HandlerProfile {
+	uint32 calls;
+	uint32 totalTime;
+	uint32 maxTime;
+
+	HandlerProfile() : calls(0), totalTime(0), maxTime(0) {}
+};
 typedef Common::Array<Datum> StackData;
 typedef Common::HashMap<Common::String, Symbol *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SymbolHash;
 typedef Common::HashMap<Common::String, Builtin *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> BuiltinHash;
@@ -173,8 +197,19 @@ public:
 
 	void runTests();
 
+	void dumpHandlerProfile();
+
+	/**
+	 * Drop the compiled scripts not used by the movie just loaded, so that
+	 * scripts of unloaded movies do not pile up.
+	 */
+	void pruneCompiledScripts();
+
 private:
 	const char *findNextDefinition(const char *s);
+	bool reuseCompiledScript(const Common::String &key, const char *code, ScriptType type, uint16 id);
+	void addDefinition(Common::String &name, Symbol *sym);
+	void profileHandler(const Common::String &name, uint32 startTime);
 
 	// lingo-events.cpp
 private:
@@ -552,6 +587,12 @@ private:
 
 	ScriptHash _scripts[kMaxScriptType + 1];
 
+	CompiledScriptHash _compiledScripts;
+	CompiledScript *_compilingScript;
+	uint32 _definitionGeneration;
+
+	Common::HashMap<Common::String, HandlerProfile> _handlerProfiles;
+
 	SymbolHash _globalvars;
 	SymbolHash *_localvars;
 
@@ -22,6 +22,7 @@
 
 #include "common/config-manager.h"
 #include "common/macresman.h"
+#include "common/system.h"
 
 #include "graphics/macgui/macwindowmanager.h"
 #include "graphics/macgui/macfontmanager.h"
@@ -248,6 +249,7 @@ void DirectorEngine::loadMac(const Common::String movie) {
 
 void DirectorEngine::loadSharedCastsFrom(Common::String filename) {
 	Archive *shardcst = createArchive();
+	uint32 loadStart = g_system->getMillis();
 
 	debug(0, "****** Loading Shared cast '%s'", filename.c_str());
 
@@ -335,6 +337,8 @@ void DirectorEngine::loadSharedCastsFrom(Common::String filename) {
 	}
 
 	_sharedScore->loadSpriteImages(true);
+
+	debugC(1, kDebugLoading, "Loaded shared cast '%s' in %d ms", filename.c_str(), g_system->getMillis() - loadStart);
 }
 
 } // End of namespace Director
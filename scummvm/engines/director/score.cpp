@@ -64,9 +64,13 @@ Score::Score(DirectorEngine *vm) {
 	_vm = vm;
 	_surface = new Graphics::ManagedSurface;
 	_trailSurface = new Graphics::ManagedSurface;
+	_composeSurface = new Graphics::ManagedSurface;
 	_lingo = _vm->getLingo();
 	_soundManager = _vm->getSoundManager();
 	_currentMouseDownSpriteId = 0;
+	_fullRedraw = true;
+	_decodedBitmapsSize = 0;
+	_bitmapUseCounter = 0;
 
 	// FIXME: TODO: Check whether the original truely does it
 	if (_vm->getVersion() <= 3) {
@@ -214,72 +218,157 @@ void Score::copyCastStxts() {
 }
 
 void Score::loadSpriteImages(bool isSharedCast) {
-	debugC(1, kDebugLoading, "****** Preloading sprite images");
+	debugC(1, kDebugLoading, "****** Indexing sprite images");
 
+	// Only remember where the image data is, decoding happens on first use
 	Common::HashMap<int, BitmapCast *>::iterator bc;
 	for (bc = _loadedBitmaps->begin(); bc != _loadedBitmaps->end(); ++bc) {
 		if (bc->_value) {
-			uint32 tag = bc->_value->tag;
-			uint16 imgId = bc->_key + 1024;
 			BitmapCast *bitmapCast = bc->_value;
 
+			bitmapCast->imgTag = bitmapCast->tag;
+			bitmapCast->imgId = bc->_key + 1024;
+
 			if (_vm->getVersion() >= 4 && bitmapCast->children.size() > 0) {
-				imgId = bitmapCast->children[0].index;
-				tag = bitmapCast->children[0].tag;
+				bitmapCast->imgId = bitmapCast->children[0].index;
+				bitmapCast->imgTag = bitmapCast->children[0].tag;
 			}
 
-			Image::ImageDecoder *img = NULL;
-			Common::SeekableReadStream *pic = NULL;
-
-			switch (tag) {
-			case MKTAG('D', 'I', 'B', ' '):
-				if (_movieArchive->hasResource(MKTAG('D', 'I', 'B', ' '), imgId)) {
-					img = new DIBDecoder();
-					img->loadStream(*_movieArchive->getResource(MKTAG('D', 'I', 'B', ' '), imgId));
-					bitmapCast->surface = img->getSurface();
-				} else if (isSharedCast && _vm->getSharedDIB() != NULL && _vm->getSharedDIB()->contains(imgId)) {
-					img = new DIBDecoder();
-					img->loadStream(*_vm->getSharedDIB()->getVal(imgId));
-					bitmapCast->surface = img->getSurface();
-				}
-				break;
-			case MKTAG('B', 'I', 'T', 'D'):
-				if (isSharedCast) {
-					debugC(4, kDebugImages, "Shared cast BMP: id: %d", imgId);
-					pic = _vm->getSharedBMP()->getVal(imgId);
-					if (pic != NULL)
-						pic->seek(0); // TODO: this actually gets re-read every loop... we need to rewind it!
-				} else 	if (_movieArchive->hasResource(MKTAG('B', 'I', 'T', 'D'), imgId)) {
-					pic = _movieArchive->getResource(MKTAG('B', 'I', 'T', 'D'), imgId);
-				}
-				break;
-			default:
-				warning("Unknown Bitmap Cast Tag: [%d] %s", tag, tag2str(tag));
-				break;
-			}
+			bitmapCast->sharedCast = isSharedCast;
+			bitmapCast->indexed = true;
+		}
+	}
+}
 
-			int w = bitmapCast->initialRect.width(), h = bitmapCast->initialRect.height();
-			debugC(4, kDebugImages, "id: %d, w: %d, h: %d, flags: %x, some: %x, unk1: %d, unk2: %d",
-				imgId, w, h, bitmapCast->flags, bitmapCast->someFlaggyThing, bitmapCast->unk1, bitmapCast->unk2);
+const Graphics::Surface *Score::getBitmapSurface(BitmapCast *bitmapCast) {
+	bitmapCast->lastUsed = ++_bitmapUseCounter;
 
-			if (pic != NULL && bitmapCast != NULL && w > 0 && h > 0) {
-				if (_vm->getVersion() < 4) {
-					img = new BITDDecoder(w, h);
-				} else if (_vm->getVersion() < 6) {
-					img = new BITDDecoderV4(w, h, bitmapCast->bitsPerPixel);
-				} else {
-					img = new Image::BitmapDecoder();
-				}
+	if (!bitmapCast->surface && bitmapCast->indexed) {
+		// Try only once, missing images would be looked up every frame otherwise
+		bitmapCast->indexed = false;
 
-				img->loadStream(*pic);
-				bitmapCast->surface = img->getSurface();
-			} else {
-				warning("Image %d not found", imgId);
-			}
+		if (decodeBitmap(bitmapCast))
+			trimBitmapCache(bitmapCast);
+	}
+
+	return bitmapCast->surface;
+}
+
+bool Score::decodeBitmap(BitmapCast *bitmapCast) {
+	uint32 tag = bitmapCast->imgTag;
+	uint16 imgId = bitmapCast->imgId;
+	bool isSharedCast = bitmapCast->sharedCast;
+	uint32 startTime = g_system->getMillis();
+
+	Image::ImageDecoder *img = NULL;
+	Common::SeekableReadStream *pic = NULL;
+
+	switch (tag) {
+	case MKTAG('D', 'I', 'B', ' '):
+		if (_movieArchive->hasResource(MKTAG('D', 'I', 'B', ' '), imgId)) {
+			img = new DIBDecoder();
+			img->loadStream(*_movieArchive->getResource(MKTAG('D', 'I', 'B', ' '), imgId));
+		} else if (isSharedCast && _vm->getSharedDIB() != NULL && _vm->getSharedDIB()->contains(imgId)) {
+			img = new DIBDecoder();
+			Common::SeekableReadStream *dib = _vm->getSharedDIB()->getVal(imgId);
+			dib->seek(0);
+			img->loadStream(*dib);
+		}
+		break;
+	case MKTAG('B', 'I', 'T', 'D'):
+		if (isSharedCast) {
+			debugC(4, kDebugImages, "Shared cast BMP: id: %d", imgId);
+			pic = _vm->getSharedBMP()->getVal(imgId);
+			if (pic != NULL)
+				pic->seek(0);
+		} else 	if (_movieArchive->hasResource(MKTAG('B', 'I', 'T', 'D'), imgId)) {
+			pic = _movieArchive->getResource(MKTAG('B', 'I', 'T', 'D'), imgId);
+		}
+		break;
+	default:
+		warning("Unknown Bitmap Cast Tag: [%d] %s", tag, tag2str(tag));
+		break;
+	}
+
+	int w = bitmapCast->initialRect.width(), h = bitmapCast->initialRect.height();
+	debugC(4, kDebugImages, "id: %d, w: %d, h: %d, flags: %x, some: %x, unk1: %d, unk2: %d",
+		imgId, w, h, bitmapCast->flags, bitmapCast->someFlaggyThing, bitmapCast->unk1, bitmapCast->unk2);
+
+	if (pic != NULL && w > 0 && h > 0) {
+		if (_vm->getVersion() < 4) {
+			img = new BITDDecoder(w, h);
+		} else if (_vm->getVersion() < 6) {
+			img = new BITDDecoderV4(w, h, bitmapCast->bitsPerPixel);
+		} else {
+			img = new Image::BitmapDecoder();
+		}
+
+		img->loadStream(*pic);
+	}
+
+	if (!img || !img->getSurface()) {
+		warning("Image %d not found", imgId);
+		delete img;
+		return false;
+	}
+
+	const Graphics::Surface *surface = img->getSurface();
+
+	bitmapCast->img = img;
+	bitmapCast->surface = surface;
+	bitmapCast->decodedSize = surface->pitch * surface->h;
+
+	_decodedBitmaps.push_back(bitmapCast);
+	_decodedBitmapsSize += bitmapCast->decodedSize;
+
+	debugC(3, kDebugLoading, "Decoded image %d (%dx%d) in %d ms, %d bitmaps use %d bytes", imgId, surface->w, surface->h,
+		g_system->getMillis() - startTime, _decodedBitmaps.size(), _decodedBitmapsSize);
+
+	return true;
+}
+
+void Score::trimBitmapCache(BitmapCast *keep) {
+	while (_decodedBitmapsSize > kDecodedBitmapsBudget && _decodedBitmaps.size() > 1) {
+		uint victim = 0;
+
+		for (uint i = 1; i < _decodedBitmaps.size(); i++) {
+			if (_decodedBitmaps[i]->lastUsed < _decodedBitmaps[victim]->lastUsed)
+				victim = i;
 		}
+
+		BitmapCast *bitmapCast = _decodedBitmaps[victim];
+
+		if (bitmapCast == keep)
+			break;
+
+		debugC(3, kDebugLoading, "Evicting decoded image %d", bitmapCast->imgId);
+
+		// Cached matte masks are keyed on the surface which goes away now
+		if (_vm->getCurrentScore())
+			_vm->getCurrentScore()->forgetMatteMask(bitmapCast->surface);
+		forgetMatteMask(bitmapCast->surface);
+
+		delete bitmapCast->img;
+		bitmapCast->img = nullptr;
+		bitmapCast->surface = nullptr;
+		bitmapCast->indexed = true;
+
+		_decodedBitmapsSize -= bitmapCast->decodedSize;
+		bitmapCast->decodedSize = 0;
+		_decodedBitmaps.remove_at(victim);
 	}
 }
 
+void Score::forgetMatteMask(const Graphics::Surface *surface) {
+	if (!_matteMasks.contains(surface))
+		return;
+
+	MatteMask *matte = _matteMasks[surface];
+	matte->mask.free();
+	delete matte;
+	_matteMasks.erase(surface);
+}
+
 Score::~Score() {
 	if (_surface)
 		_surface->free();
@@ -287,8 +376,23 @@ Score::~Score() {
 	if (_trailSurface)
 		_trailSurface->free();
 
+	if (_composeSurface)
+		_composeSurface->free();
+
 	delete _surface;
 	delete _trailSurface;
+	delete _composeSurface;
+
+	for (uint i = 0; i < _decodedBitmaps.size(); i++) {
+		delete _decodedBitmaps[i]->img;
+		_decodedBitmaps[i]->img = nullptr;
+		_decodedBitmaps[i]->surface = nullptr;
+	}
+
+	for (Common::HashMap<const Graphics::Surface *, MatteMask *>::iterator it = _matteMasks.begin(); it != _matteMasks.end(); ++it) {
+		it->_value->mask.free();
+		delete it->_value;
+	}
 
 	if (_movieArchive)
 		_movieArchive->close();
@@ -1174,6 +1278,7 @@ void Score::startLoop() {
 
 	_surface->create(_movieRect.width(), _movieRect.height());
 	_trailSurface->create(_movieRect.width(), _movieRect.height());
+	_composeSurface->create(_movieRect.width(), _movieRect.height());
 
 	if (_stageColor == 0)
 		_trailSurface->clear(_vm->getPaletteColorCount() - 1);
@@ -1183,6 +1288,7 @@ void Score::startLoop() {
 	_currentFrame = 0;
 	_stopPlay = false;
 	_nextFrameTime = 0;
+	_fullRedraw = true;
 
 	_frames[_currentFrame]->prepareFrame(this);
 
@@ -1199,9 +1305,6 @@ void Score::update() {
 	if (g_system->getMillis() < _nextFrameTime)
 		return;
 
-	_surface->clear();
-	_surface->copyFrom(*_trailSurface);
-
 	_lingo->executeImmediateScripts(_frames[_currentFrame]);
 
 	// Enter and exit from previous frame (Director 4)
@@ -25,6 +25,7 @@
 
 #include "common/substream.h"
 #include "common/rect.h"
+#include "common/hash-ptr.h"
 #include "director/archive.h"
 #include "director/cast.h"
 #include "director/images.h"
@@ -58,6 +59,52 @@ enum ScriptType {
 
 const char *scriptType2str(ScriptType scr);
 
+enum {
+	kDecodedBitmapsBudget = 16 * 1024 * 1024 // Bytes of decoded cast bitmaps kept per score
+};
+
+// What a sprite channel drew on the stage during the last rendered frame.
+// Channels whose sprite did not change keep their pixels, and only the
+// union of the changed areas is composed again.
+struct ChannelState {
+	bool enabled;
+	uint16 castId;
+	int ink;
+	uint16 trails;
+	byte spriteType;
+	Common::Point startPoint;
+	uint16 width;
+	uint16 height;
+	byte foreColor;
+	byte backColor;
+	byte lineSize;
+	bool mouseDown;
+	const void *cast;
+	bool volatileContent; // Contents may change while the sprite stays the same
+	Common::Rect bounds; // Everything drawn, including trails
+	Common::Array<Common::Rect> drawRects; // Hit areas registered for the stage
+
+	ChannelState() : enabled(false), castId(0), ink(0), trails(0), spriteType(0), width(0), height(0),
+		foreColor(0), backColor(0), lineSize(0), mouseDown(false), cast(nullptr), volatileContent(false) {}
+
+	// Whether the sprite would be drawn the same, regardless of what it drew before
+	bool sameSprite(const ChannelState &c) const {
+		return enabled == c.enabled && castId == c.castId && ink == c.ink && trails == c.trails &&
+			spriteType == c.spriteType && startPoint == c.startPoint && width == c.width && height == c.height &&
+			foreColor == c.foreColor && backColor == c.backColor && lineSize == c.lineSize &&
+			mouseDown == c.mouseDown && cast == c.cast;
+	}
+};
+
+// Mask of the white pixels reachable from the border of a bitmap, which
+// the matte ink leaves transparent
+struct MatteMask {
+	int whiteColor;
+	Graphics::Surface mask;
+
+	MatteMask() : whiteColor(-1) {}
+};
+
 class Score {
 public:
 	Score(DirectorEngine *vm);
@@ -83,6 +130,8 @@ public:
 	Sprite *getSpriteById(uint16 id);
 	void setSpriteCasts();
 	void loadSpriteImages(bool isSharedCast);
+	const Graphics::Surface *getBitmapSurface(BitmapCast *bitmapCast);
+	void forgetMatteMask(const Graphics::Surface *surface);
 	void copyCastStxts();
 	Graphics::ManagedSurface *getSurface() { return _surface; }
 
@@ -110,6 +159,9 @@ private:
 
 	bool processImmediateFrameScript(Common::String s, int id);
 
+	bool decodeBitmap(BitmapCast *bitmapCast);
+	void trimBitmapCache(BitmapCast *keep);
+
 public:
 	Common::Array<Frame *> _frames;
 	Common::HashMap<int, CastType> _castTypes;
@@ -121,6 +173,7 @@ public:
 	Common::HashMap<uint16, Common::String> _fontMap;
 	Graphics::ManagedSurface *_surface;
 	Graphics::ManagedSurface *_trailSurface;
+	Graphics::ManagedSurface *_composeSurface;
 	Graphics::Font *_font;
 	Archive *_movieArchive;
 	Common::Rect _movieRect;
@@ -137,6 +190,10 @@ public:
 	Common::HashMap<int, ScriptCast *> *_loadedScripts;
 	Common::HashMap<int, const Stxt *> *_loadedStxts;
 
+	Common::Array<ChannelState> _channelStates;
+	bool _fullRedraw;
+	Common::HashMap<const Graphics::Surface *, MatteMask *> _matteMasks;
+
 private:
 	uint16 _versionMinor;
 	uint16 _versionMajor;
@@ -156,6 +213,10 @@ private:
 	Lingo *_lingo;
 	DirectorSound *_soundManager;
 	DirectorEngine *_vm;
+
+	Common::Array<BitmapCast *> _decodedBitmaps;
+	uint32 _decodedBitmapsSize;
+	uint32 _bitmapUseCounter;
 };
 
 } // End of namespace Director
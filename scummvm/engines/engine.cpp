@@ -33,6 +33,7 @@
 #include "engines/util.h"
 
 #include "common/config-manager.h"
+#include "common/debug.h"
 #include "common/events.h"
 #include "common/file.h"
 #include "common/system.h"
@@ -531,7 +532,9 @@ void Engine::openMainMenuDialog() {
 	// mouse cursor glitches and similar bugs,
 	// e.g. #2822778).
 	if (_saveSlotToLoad >= 0) {
+		const uint32 loadStart = _system->getMillis();
 		Common::Error status = loadGameState(_saveSlotToLoad);
+		debug(1, "Loading saved game from slot %d took %u ms", _saveSlotToLoad, _system->getMillis() - loadStart);
 		if (status.getCode() != Common::kNoError) {
 			Common::String failMessage = Common::String::format(_("Failed to load saved game (%s)! "
 				  "Please consult the README for basic information, and for "
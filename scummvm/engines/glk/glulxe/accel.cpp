@@ -83,8 +83,11 @@ acceleration_func Glulxe::accel_get_func(uint addr) {
 
 	bucknum = (addr % ACCEL_HASH_SIZE);
 	for (ptr = accelentries[bucknum]; ptr; ptr = ptr->next) {
-		if (ptr->addr == addr)
+		if (ptr->addr == addr) {
+			if (ptr->func)
+				ptr->calls++;
 			return ptr->func;
+		}
 	}
 	return nullptr;
 }
@@ -105,6 +108,18 @@ void Glulxe::accel_iterate_funcs(void (*func)(uint index, uint addr)) {
 	}
 }
 
+void Glulxe::accel_iterate_entries(void (*func)(const accelentry_t *entry, void *refcon), void *refcon) const {
+	if (!accelentries)
+		return;
+
+	for (int bucknum = 0; bucknum < ACCEL_HASH_SIZE; bucknum++) {
+		for (const accelentry_t *ptr = accelentries[bucknum]; ptr; ptr = ptr->next) {
+			if (ptr->func)
+				func(ptr, refcon);
+		}
+	}
+}
+
 void Glulxe::accel_set_func(uint index, uint addr) {
 	int bucknum;
 	accelentry_t *ptr;
@@ -144,6 +159,7 @@ void Glulxe::accel_set_func(uint index, uint addr) {
 		ptr->addr = addr;
 		ptr->index = 0;
 		ptr->func = nullptr;
+		ptr->calls = 0;
 		ptr->next = accelentries[bucknum];
 		accelentries[bucknum] = ptr;
 	}
@@ -0,0 +1,115 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "glk/glulxe/debugger.h"
+#include "glk/glulxe/glulxe.h"
+#include "common/algorithm.h"
+
+namespace Glk {
+namespace Glulxe {
+
+/**
+ * Number of entries shown by the opcodes command
+ */
+static const uint kOpcodesShown = 20;
+
+struct OpcodeCount {
+	uint opcode;
+	uint count;
+};
+
+static bool opcodeCountGreater(const OpcodeCount &a, const OpcodeCount &b) {
+	return a.count > b.count;
+}
+
+static void printAccelEntry(const accelentry_t *entry, void *refcon) {
+	Debugger *debugger = (Debugger *)refcon;
+	debugger->debugPrintf("  func %2d at %08x: %u calls\n", entry->index, entry->addr, entry->calls);
+}
+
+Debugger::Debugger() : Glk::Debugger() {
+	registerCmd("opcodes", WRAP_METHOD(Debugger, cmdOpcodes));
+	registerCmd("accel", WRAP_METHOD(Debugger, cmdAccel));
+}
+
+bool Debugger::cmdOpcodes(int argc, const char **argv) {
+	Glulxe *vm = g_vm;
+
+	if (argc == 2 && !strcmp(argv[1], "on")) {
+		vm->opcode_profiling = true;
+		debugPrintf("Opcode counting enabled\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "off")) {
+		vm->opcode_profiling = false;
+		debugPrintf("Opcode counting disabled\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "reset")) {
+		Common::fill(&vm->opcode_counts[0], &vm->opcode_counts[OPCODE_COUNT_SIZE], 0);
+		vm->decodedcache_hits = vm->decodedcache_misses = vm->decodedcache_flushes = 0;
+		debugPrintf("Opcode counts cleared\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Format: opcodes [on | off | reset]\n");
+		return true;
+	}
+
+	debugPrintf("Decoded instruction cache: %u hits, %u misses, %u flushes\n",
+		vm->decodedcache_hits, vm->decodedcache_misses, vm->decodedcache_flushes);
+
+	if (!vm->opcode_profiling)
+		debugPrintf("Opcode counting is disabled, use 'opcodes on' to enable it\n");
+
+	Common::Array<OpcodeCount> counts;
+	uint total = 0;
+
+	for (uint ix = 0; ix < OPCODE_COUNT_SIZE; ix++) {
+		if (vm->opcode_counts[ix]) {
+			OpcodeCount oc;
+			oc.opcode = ix;
+			oc.count = vm->opcode_counts[ix];
+			counts.push_back(oc);
+			total += oc.count;
+		}
+	}
+
+	if (counts.empty())
+		return true;
+
+	Common::sort(counts.begin(), counts.end(), opcodeCountGreater);
+
+	debugPrintf("%u opcodes executed, most frequent:\n", total);
+	for (uint ix = 0; ix < counts.size() && ix < kOpcodesShown; ix++) {
+		debugPrintf("  %s%03x: %u (%u%%)\n", counts[ix].opcode == OPCODE_COUNT_SIZE - 1 ? ">=" : "  ",
+			counts[ix].opcode, counts[ix].count, (uint)((uint64)counts[ix].count * 100 / total));
+	}
+
+	return true;
+}
+
+bool Debugger::cmdAccel(int argc, const char **argv) {
+	debugPrintf("Accelerated functions:\n");
+	g_vm->accel_iterate_entries(printAccelEntry, this);
+	return true;
+}
+
+} // End of namespace Glulxe
+} // End of namespace Glk
@@ -0,0 +1,49 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GLK_GLULXE_DEBUGGER_H
+#define GLK_GLULXE_DEBUGGER_H
+
+#include "glk/debugger.h"
+
+namespace Glk {
+namespace Glulxe {
+
+class Debugger : public Glk::Debugger {
+private:
+	/**
+	 * Show or control the counting of executed opcodes
+	 */
+	bool cmdOpcodes(int argc, const char **argv);
+
+	/**
+	 * Show how often the accelerated functions were called
+	 */
+	bool cmdAccel(int argc, const char **argv);
+public:
+	Debugger();
+};
+
+} // End of namespace Glulxe
+} // End of namespace Glk
+
+#endif
@@ -30,6 +30,7 @@ void Glulxe::execute_loop() {
 	int ix;
 	uint opcode;
 	const operandlist_t *oplist;
+	decodedinst_t *di;
 	oparg_t inst[MAX_OPERANDS];
 	uint value, addr, val0, val1;
 	int vals0, vals1;
@@ -49,44 +50,69 @@ void Glulxe::execute_loop() {
 		/* Stash the current opcode's address, in case the interpreter needs to serialize the VM state out-of-band. */
 		prevpc = pc;
 
-		/* Fetch the opcode number. */
-		opcode = Mem1(pc);
-		pc++;
-		if (opcode & 0x80) {
-			/* More than one-byte opcode. */
-			if (opcode & 0x40) {
-				/* Four-byte opcode */
-				opcode &= 0x3F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
+		/* Instructions in ROM can't change, so their opcode and operand modes are only parsed
+		   once and then kept in the decoded instruction cache. */
+		di = nullptr;
+		if (pc < ramstart) {
+			di = &decodedcache[pc & (DECODED_CACHE_SIZE - 1)];
+			if (di->addr == pc) {
+				decodedcache_hits++;
+			} else if (decode_instruction(pc, di)) {
+				di->addr = pc;
+				decodedcache_misses++;
 			} else {
-				/* Two-byte opcode */
-				opcode &= 0x7F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
+				di->addr = 0;
+				di = nullptr;
 			}
 		}
 
-		/* Now we have an opcode number. */
+		if (di) {
+			opcode = di->opcode;
+			load_decoded_operands(inst, di);
+			pc = di->nextpc;
+		} else {
+			/* Fetch the opcode number. */
+			opcode = Mem1(pc);
+			pc++;
+			if (opcode & 0x80) {
+				/* More than one-byte opcode. */
+				if (opcode & 0x40) {
+					/* Four-byte opcode */
+					opcode &= 0x3F;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+				} else {
+					/* Two-byte opcode */
+					opcode &= 0x7F;
+					opcode = (opcode << 8) | Mem1(pc);
+					pc++;
+				}
+			}
 
-		/* Fetch the structure that describes how the operands for this
-		   opcode are arranged. This is a pointer to an immutable,
-		   static object. */
-		if (opcode < 0x80)
-			oplist = fast_operandlist[opcode];
-		else
-			oplist = lookup_operandlist(opcode);
+			/* Now we have an opcode number. */
 
-		if (!oplist)
-			fatal_error_i("Encountered unknown opcode.", opcode);
+			/* Fetch the structure that describes how the operands for this
+			   opcode are arranged. This is a pointer to an immutable,
+			   static object. */
+			if (opcode < 0x80)
+				oplist = fast_operandlist[opcode];
+			else
+				oplist = lookup_operandlist(opcode);
+
+			if (!oplist)
+				fatal_error_i("Encountered unknown opcode.", opcode);
+
+			/* Based on the oplist structure, load the actual operand values
+			   into inst. This moves the PC up to the end of the instruction. */
+			parse_operands(inst, oplist);
+		}
 
-		/* Based on the oplist structure, load the actual operand values
-		   into inst. This moves the PC up to the end of the instruction. */
-		parse_operands(inst, oplist);
+		if (opcode_profiling)
+			opcode_counts[MIN<uint>(opcode, OPCODE_COUNT_SIZE - 1)]++;
 
 		/* Perform the opcode. This switch statement is split in two, based
 		   on some paranoid suspicions about the ability of compilers to
@@ -21,6 +21,8 @@
  */
 
 #include "glk/glulxe/glulxe.h"
+#include "glk/glulxe/debugger.h"
+#include "common/algorithm.h"
 #include "common/config-manager.h"
 #include "common/translation.h"
 
@@ -46,12 +48,21 @@ Glulxe::Glulxe(OSystem *syst, const GlkGameDescription &gameDesc) : GlkAPI(syst,
 		// serial
 		max_undo_level(8), undo_chain_size(0), undo_chain_num(0), undo_chain(nullptr), ramcache(nullptr),
 		// string
-		iosys_mode(0), iosys_rock(0), tablecache_valid(false), glkio_unichar_han_ptr(nullptr) {
+		iosys_mode(0), iosys_rock(0), tablecache_valid(false), glkio_unichar_han_ptr(nullptr),
+		// operand
+		decodedcache_hits(0), decodedcache_misses(0), decodedcache_flushes(0), opcode_profiling(false) {
 	g_vm = this;
 
+	decodedcache_flush();
+	Common::fill(&opcode_counts[0], &opcode_counts[OPCODE_COUNT_SIZE], 0);
+
 	glkopInit();
 }
 
+Glk::Debugger *Glulxe::createDebugger() {
+	return new Debugger();
+}
+
 void Glulxe::runGame() {
 	if (!is_gamefile_valid())
 		return;
@@ -32,6 +32,7 @@ namespace Glk {
 namespace Glulxe {
 
 class Glulxe;
+class Debugger;
 typedef void (Glulxe::*CharHandler)(unsigned char);
 typedef void (Glulxe::*UnicharHandler)(uint32);
 
@@ -39,6 +40,7 @@ typedef void (Glulxe::*UnicharHandler)(uint32);
  * Glulxe game interpreter
  */
 class Glulxe : public GlkAPI {
+	friend class Debugger;
 private:
 	/**
 	 * \defgroup vm fields
@@ -143,6 +145,22 @@ private:
 	 */
 	const operandlist_t *fast_operandlist[0x80];
 
+	/**
+	 * Predecoded ROM instructions, indexed by the low bits of their address
+	 */
+	decodedinst_t decodedcache[DECODED_CACHE_SIZE];
+	uint decodedcache_hits, decodedcache_misses, decodedcache_flushes;
+
+	/**@}*/
+
+	/**
+	 * \defgroup opcode profiling fields
+	 * @{
+	 */
+
+	bool opcode_profiling;
+	uint opcode_counts[OPCODE_COUNT_SIZE];
+
 	/**@}*/
 
 	/**
@@ -395,6 +413,11 @@ public:
 	 */
 	Glulxe(OSystem *syst, const GlkGameDescription &gameDesc);
 
+	/**
+	 * Creates a debugger instance
+	 */
+	Glk::Debugger *createDebugger() override;
+
 	/**
 	 * Run the game
 	 */
@@ -538,6 +561,24 @@ public:
 	*/
 	void parse_operands(oparg_t *opargs, const operandlist_t *oplist);
 
+	/**
+	 * Parse the instruction at the given address into a predecoded instruction, without loading
+	 * any operand values. Returns false if it can't be predecoded; it should then be executed
+	 * through parse_operands(), which also reports any errors in it.
+	 */
+	bool decode_instruction(uint addr, decodedinst_t *di);
+
+	/**
+	 * Load the operand values of a predecoded instruction into args, like parse_operands() does.
+	 * This does not move the PC.
+	 */
+	void load_decoded_operands(oparg_t *args, const decodedinst_t *di);
+
+	/**
+	 * Forget all predecoded instructions. This is needed whenever ROM contents may have changed.
+	 */
+	void decodedcache_flush();
+
 	/**
 	 * Store a result value, according to the desttype and destaddress given. This is usually used to store
 	 * the result of an opcode, but it's also used by any code that pulls a call-stub off the stack.
@@ -870,6 +911,12 @@ public:
 	 */
 	void accel_iterate_funcs(void(*func)(uint index, uint addr));
 
+	/**
+	 * Iterate the active acceleration entries, including how many times each one was called.
+	 * This is used by the debugger.
+	 */
+	void accel_iterate_entries(void(*func)(const accelentry_t *entry, void *refcon), void *refcon) const;
+
 	/**@}*/
 
 	/**
@@ -92,9 +92,15 @@ class Glulxe;
 #define Mem1(adr)  (Read1(memmap+(adr)))
 #define Mem2(adr)  (Read2(memmap+(adr)))
 #define Mem4(adr)  (Read4(memmap+(adr)))
-#define MemW1(adr, vl)  (VerifyW(adr, 1), Write1(memmap+(adr), (vl)))
-#define MemW2(adr, vl)  (VerifyW(adr, 2), Write2(memmap+(adr), (vl)))
-#define MemW4(adr, vl)  (VerifyW(adr, 4), Write4(memmap+(adr), (vl)))
+#define MemW1(adr, vl)  (VerifyW(adr, 1), DecodedW(adr), Write1(memmap+(adr), (vl)))
+#define MemW2(adr, vl)  (VerifyW(adr, 2), DecodedW(adr), Write2(memmap+(adr), (vl)))
+#define MemW4(adr, vl)  (VerifyW(adr, 4), DecodedW(adr), Write4(memmap+(adr), (vl)))
+
+/**
+ * Writing to ROM is illegal, but is not checked unless VERIFY_MEMORY_ACCESS is set. Drop the predecoded
+ * instructions if it happens anyway, as they may have just changed.
+ */
+#define DecodedW(adr)  ((adr) < ramstart ? (decodedcache_flush(), 0) : 0)
 
 #ifndef _HUGE_ENUF
 #define _HUGE_ENUF  1e+300  // _HUGE_ENUF*_HUGE_ENUF must overflow
@@ -352,12 +358,46 @@ typedef oparg_struct oparg_t;
 
 #define MAX_OPERANDS (8)
 
+/**
+ * How an operand of a predecoded instruction is fetched
+ */
+enum decodedmode {
+	decodedmode_Const = 0,  ///< value is the operand itself
+	decodedmode_Pop = 1,    ///< pop the operand off the stack
+	decodedmode_Mem = 2,    ///< value is a main memory address
+	decodedmode_Local = 3,  ///< value is an offset in the locals segment
+	decodedmode_Store = 4   ///< desttype and value are the final store destination
+};
+
+/**
+ * An instruction whose opcode and operand modes were parsed ahead of time. Only instructions
+ * in ROM are predecoded, since those can never change while the game runs.
+ */
+struct decodedinst_struct {
+	uint addr;              ///< Address of the instruction, zero for an unused entry
+	uint opcode;
+	uint nextpc;            ///< Address of the following instruction
+	const operandlist_t *oplist;
+	byte modes[MAX_OPERANDS];
+	byte desttypes[MAX_OPERANDS];
+	uint values[MAX_OPERANDS];
+};
+typedef decodedinst_struct decodedinst_t;
+
+#define DECODED_CACHE_SIZE (4096)
+
+/**
+ * Number of opcode counters kept while profiling opcodes. Opcodes past the end share the last one.
+ */
+#define OPCODE_COUNT_SIZE (0x200)
+
 typedef uint(Glulxe::*acceleration_func)(uint argc, uint *argv);
 
 struct accelentry_struct {
 	uint addr;
 	uint index;
 	acceleration_func func;
+	uint calls;
 	accelentry_struct *next;
 };
 typedef accelentry_struct accelentry_t;
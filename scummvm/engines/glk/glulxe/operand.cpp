@@ -517,6 +517,214 @@ WrLocalsAddr:
 	}
 }
 
+bool Glulxe::decode_instruction(uint addr, decodedinst_t *di) {
+	uint opcode;
+	const operandlist_t *oplist;
+
+	opcode = Mem1(addr);
+	addr++;
+	if (opcode & 0x80) {
+		if (opcode & 0x40) {
+			opcode = ((opcode & 0x3F) << 24) | (Mem1(addr) << 16) | (Mem1(addr + 1) << 8) | Mem1(addr + 2);
+			addr += 3;
+		} else {
+			opcode = ((opcode & 0x7F) << 8) | Mem1(addr);
+			addr++;
+		}
+	}
+
+	if (opcode < 0x80)
+		oplist = fast_operandlist[opcode];
+	else
+		oplist = lookup_operandlist(opcode);
+
+	if (!oplist)
+		return false;
+
+	int numops = oplist->num_ops;
+	uint modeaddr = addr;
+	int modeval = 0;
+
+	addr += (numops + 1) / 2;
+
+	for (int ix = 0; ix < numops; ix++) {
+		int mode;
+		uint value = 0;
+		byte kind;
+
+		if ((ix & 1) == 0) {
+			modeval = Mem1(modeaddr);
+			mode = (modeval & 0x0F);
+		} else {
+			mode = ((modeval >> 4) & 0x0F);
+			modeaddr++;
+		}
+
+		/* Immediate data of the operand, with the same sizes and sign extension as parse_operands() */
+		switch (mode) {
+		case 1:
+			value = (int)(signed char)(Mem1(addr));
+			addr++;
+			break;
+		case 2:
+			value = ((int)(signed char)(Mem1(addr)) << 8) | (uint)(Mem1(addr + 1));
+			addr += 2;
+			break;
+		case 5:
+		case 9:
+		case 13:
+			value = (uint)(Mem1(addr));
+			addr++;
+			break;
+		case 6:
+		case 10:
+		case 14:
+			value = (uint)Mem2(addr);
+			addr += 2;
+			break;
+		case 3:
+		case 7:
+		case 11:
+		case 15:
+			value = Mem4(addr);
+			addr += 4;
+			break;
+		default:
+			break;
+		}
+
+		if (mode >= 13)
+			value += ramstart;
+
+		di->desttypes[ix] = 0;
+
+		if (oplist->formlist[ix] == modeform_Load) {
+			switch (mode) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				kind = decodedmode_Const;
+				break;
+			case 8:
+				kind = decodedmode_Pop;
+				break;
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15:
+				kind = decodedmode_Mem;
+				break;
+			case 9:
+			case 10:
+			case 11:
+				kind = decodedmode_Local;
+				break;
+			default:
+				return false;
+			}
+		} else {
+			kind = decodedmode_Store;
+
+			switch (mode) {
+			case 0:
+				value = 0;
+				break;
+			case 8:
+				di->desttypes[ix] = 3;
+				value = 0;
+				break;
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15:
+				di->desttypes[ix] = 1;
+				break;
+			case 9:
+			case 10:
+			case 11:
+				di->desttypes[ix] = 2;
+				break;
+			default:
+				return false;
+			}
+		}
+
+		di->modes[ix] = kind;
+		di->values[ix] = value;
+	}
+
+	/* An instruction running past the end of ROM could be changed by RAM writes. */
+	if (addr > ramstart)
+		return false;
+
+	di->opcode = opcode;
+	di->oplist = oplist;
+	di->nextpc = addr;
+
+	return true;
+}
+
+void Glulxe::load_decoded_operands(oparg_t *args, const decodedinst_t *di) {
+	int numops = di->oplist->num_ops;
+	int argsize = di->oplist->arg_size;
+
+	for (int ix = 0; ix < numops; ix++) {
+		uint value = di->values[ix];
+		uint addr;
+
+		args[ix].desttype = di->desttypes[ix];
+
+		switch (di->modes[ix]) {
+		case decodedmode_Pop:
+			if (stackptr < valstackbase + 4) {
+				fatal_error("Stack underflow in operand.");
+			}
+			stackptr -= 4;
+			value = Stk4(stackptr);
+			break;
+
+		case decodedmode_Mem:
+			if (argsize == 4) {
+				value = Mem4(value);
+			} else if (argsize == 2) {
+				value = Mem2(value);
+			} else {
+				value = Mem1(value);
+			}
+			break;
+
+		case decodedmode_Local:
+			addr = value + localsbase;
+			if (argsize == 4) {
+				value = Stk4(addr);
+			} else if (argsize == 2) {
+				value = Stk2(addr);
+			} else {
+				value = Stk1(addr);
+			}
+			break;
+
+		default:
+			/* Constants and store destinations are used as they are. */
+			break;
+		}
+
+		args[ix].value = value;
+	}
+}
+
+void Glulxe::decodedcache_flush() {
+	for (int ix = 0; ix < DECODED_CACHE_SIZE; ix++)
+		decodedcache[ix].addr = 0;
+
+	decodedcache_flushes++;
+}
+
 void Glulxe::store_operand(uint desttype, uint destaddr, uint storeval) {
 	switch (desttype) {
 
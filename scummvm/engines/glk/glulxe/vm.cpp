@@ -156,6 +156,9 @@ void Glulxe::vm_restart() {
 		memmap[lx] = 0;
 	}
 
+	/* Memory was reloaded behind the back of the instruction cache. */
+	decodedcache_flush();
+
 	/* Reset all the registers */
 	stackptr = 0;
 	frameptr = 0;
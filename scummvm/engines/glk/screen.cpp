@@ -97,6 +97,7 @@ void Screen::loadFonts() {
 	}
 
 	loadFonts(archive);
+	clearCharWidths();
 
 	delete archive;
 }
@@ -171,8 +172,36 @@ size_t Screen::stringWidth(int fontIdx, const Common::String &text, int spw) {
 }
 
 size_t Screen::stringWidthUni(int fontIdx, const Common::U32String &text, int spw) {
+	// Same as Font::getStringWidth(), but going through the character width cache
+	int width = 0;
+	uint32 prev = 0;
+
+	for (uint idx = 0; idx < text.size(); ++idx) {
+		width += charWidthUni(fontIdx, text[idx], prev);
+		prev = text[idx];
+	}
+
+	return width;
+}
+
+int Screen::charWidthUni(int fontIdx, uint32 ch, uint32 prev) {
 	const Graphics::Font *font = _fonts[fontIdx];
-	return font->getStringWidth(text) * GLI_SUBPIX;
+	int width;
+
+	if (ch < 256 && fontIdx < FONTS_TOTAL) {
+		width = _charWidths[fontIdx][ch];
+		if (width == -1)
+			width = _charWidths[fontIdx][ch] = font->getCharWidth(ch);
+	} else {
+		width = font->getCharWidth(ch);
+	}
+
+	return (width + font->getKerningOffset(prev, ch)) * GLI_SUBPIX;
+}
+
+void Screen::clearCharWidths() {
+	for (int idx = 0; idx < FONTS_TOTAL; ++idx)
+		Common::fill(&_charWidths[idx][0], &_charWidths[idx][256], -1);
 }
 
 } // End of namespace Glk
@@ -55,6 +55,11 @@ private:
 		double size, double aspect, int style);
 protected:
 	Common::Array<const Graphics::Font *> _fonts;
+
+	/**
+	 * Advance widths of the first 256 characters of each font, or -1 when not yet known
+	 */
+	int _charWidths[FONTS_TOTAL][256];
 protected:
 	/**
 	 * Load the fonts
@@ -69,7 +74,9 @@ public:
 	/**
 	 * Constructor
 	 */
-	Screen() : Graphics::Screen() {}
+	Screen() : Graphics::Screen() {
+		clearCharWidths();
+	}
 
 	/**
 	 * Destructor
@@ -128,6 +135,20 @@ public:
 	 * @returns         Width of string multiplied by GLI_SUBPIX
 	 */
 	size_t stringWidthUni(int fontIdx, const Common::U32String &text, int spw = 0);
+
+	/**
+	 * Get the width in pixels a character adds to a string
+	 * @param fontIdx   Which font to use
+	 * @param ch        Character to get the width of
+	 * @param prev      Previous character of the string, or 0 at the start of it, for kerning
+	 * @returns         Width of the character multiplied by GLI_SUBPIX
+	 */
+	int charWidthUni(int fontIdx, uint32 ch, uint32 prev);
+
+	/**
+	 * Forget the cached character widths, after fonts were changed
+	 */
+	void clearCharWidths();
 };
 
 } // End of namespace Glk
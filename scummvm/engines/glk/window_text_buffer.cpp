@@ -39,15 +39,16 @@ namespace Glk {
 TextBufferWindow::TextBufferWindow(Windows *windows, uint rock) : TextWindow(windows, rock),
 		_font(g_conf->_propInfo), _historyPos(0), _historyFirst(0), _historyPresent(0),
 		_lastSeen(0), _scrollPos(0), _scrollMax(0), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
-		_inBuf(nullptr), _lineTerminators(nullptr), _echoLineInput(true), _ladjw(0), _radjw(0),
-		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _spaced(0), _dashed(0),
-		_copyBuf(0), _copyPos(0) {
+		_inBuf(nullptr), _lineTerminators(nullptr), _echoLineInput(true), _lineWidthsValid(0),
+		_ladjw(0), _radjw(0), _ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr),
+		_spaced(0), _dashed(0), _copyBuf(0), _copyPos(0) {
 	_type = wintype_TextBuffer;
 	_history.resize(HISTORYLEN);
 
 	_lines.resize(SCROLLBACK);
 	_chars = _lines[0]._chars;
 	_attrs = _lines[0]._attrs;
+	_lineWidths[0] = 0;
 
 	Common::copy(&g_conf->_tStyles[0], &g_conf->_tStyles[style_NUMSTYLES], _styles);
 }
@@ -304,6 +305,8 @@ void TextBufferWindow::putText(const char *buf, int len, int pos, int oldlen) {
 	if (_numChars + diff >= TBLINELEN)
 		return;
 
+	invalidateLineWidth(pos);
+
 	if (diff != 0 && pos + oldlen < _numChars) {
 		memmove(_chars + pos + len,
 				_chars + pos + oldlen,
@@ -336,6 +339,8 @@ void TextBufferWindow::putTextUni(const uint32 *buf, int len, int pos, int oldle
 	if (_numChars + diff >= TBLINELEN)
 		return;
 
+	invalidateLineWidth(pos);
+
 	if (diff != 0 && pos + oldlen < _numChars) {
 		memmove(_chars + pos + len,
 				_chars + pos + oldlen,
@@ -473,6 +478,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 		}
 	}
 
+	invalidateLineWidth(_numChars);
 	_chars[_numChars] = ch;
 	_attrs[_numChars] = _attr;
 	_numChars++;
@@ -484,7 +490,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 			&& !_styles[_attrs[linelen - 1].style].reverse)
 		linelen--;
 
-	if (calcWidth(_chars, _attrs, 0, linelen, -1) >= pw) {
+	if (lineWidth(linelen) >= pw) {
 		bpoint = _numChars;
 
 		for (i = _numChars - 1; i > 0; i--) {
@@ -502,6 +508,7 @@ void TextBufferWindow::putCharUni(uint32 ch) {
 
 		scrollOneLine(0);
 
+		invalidateLineWidth(0);
 		memcpy(_chars, bchars, saved * 4);
 		memcpy(_attrs, battrs, saved * sizeof(Attributes));
 		_numChars = saved;
@@ -536,6 +543,7 @@ void TextBufferWindow::clear() {
 	_dashed = 0;
 
 	_numChars = 0;
+	invalidateLineWidth(0);
 
 	for (i = 0; i < _scrollBack; i++) {
 		_lines[i]._len = 0;
@@ -620,7 +628,7 @@ void TextBufferWindow::requestLineEvent(char *buf, uint maxlen, uint initlen) {
 	// make sure we have some space left for typing...
 	pw = (_bbox.right - _bbox.left - g_conf->_tMarginX * 2) * GLI_SUBPIX;
 	pw = pw - 2 * SLOP - _radjw + _ladjw;
-	if (calcWidth(_chars, _attrs, 0, _numChars, -1) >= pw * 3 / 4)
+	if (lineWidth(_numChars) >= pw * 3 / 4)
 		putCharUni('\n');
 
 	_inBuf = buf;
@@ -678,7 +686,7 @@ void TextBufferWindow::requestLineEventUni(uint32 *buf, uint maxlen, uint initle
 	// make sure we have some space left for typing...
 	pw = (_bbox.right - _bbox.left - g_conf->_tMarginX * 2) * GLI_SUBPIX;
 	pw = pw - 2 * SLOP - _radjw + _ladjw;
-	if (calcWidth(_chars, _attrs, 0, _numChars, -1) >= pw * 3 / 4)
+	if (lineWidth(_numChars) >= pw * 3 / 4)
 		putCharUni('\n');
 
 	//_lastSeen = 0;
@@ -1540,11 +1548,15 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	// The oldest row is recycled as the new current line
+	_lines.rotate();
+	_chars = _lines[0]._chars;
+	_attrs = _lines[0]._attrs;
+	_lines[0]._repaint = false;
+	invalidateLineWidth(0);
+
+	for (int i = 1; i < _height && i < _scrollBack; i++)
+		touch(i);
 
 	if (_radjn)
 		_radjn--;
@@ -1584,6 +1596,7 @@ void TextBufferWindow::scrollResize() {
 
 	_chars = _lines[0]._chars;
 	_attrs = _lines[0]._attrs;
+	invalidateLineWidth(0);
 
 	for (i = _scrollBack; i < (_scrollBack + SCROLLBACK); i++) {
 		_lines[i]._dirty = false;
@@ -1622,6 +1635,22 @@ int TextBufferWindow::calcWidth(const uint32 *chars, const Attributes *attrs, in
 	return w;
 }
 
+int TextBufferWindow::lineWidth(int numChars) {
+	Screen &screen = *g_vm->_screen;
+
+	// Same result as calcWidth(_chars, _attrs, 0, numChars, -1): every run of characters with
+	// the same attributes is measured on its own, so kerning only applies within a run
+	for (int i = _lineWidthsValid; i < numChars; i++) {
+		uint32 prev = (i > 0 && _attrs[i] == _attrs[i - 1]) ? _chars[i - 1] : 0;
+		_lineWidths[i + 1] = _lineWidths[i] + screen.charWidthUni(_attrs[i].attrFont(_styles), _chars[i], prev);
+	}
+
+	if (numChars > _lineWidthsValid)
+		_lineWidthsValid = numChars;
+
+	return _lineWidths[numChars];
+}
+
 void TextBufferWindow::getSize(uint *width, uint *height) const {
 	if (width)
 		*width = (_bbox.width() - g_conf->_tMarginX * 2) / _font._cellW;
@@ -1636,6 +1665,32 @@ void TextBufferWindow::flowBreak() {
 
 /*--------------------------------------------------------------------------*/
 
+void TextBufferWindow::TextBufferRows::resize(uint count) {
+	// Put the rows back in order before the ring size changes
+	if (_head) {
+		Common::Array<TextBufferRow> rows;
+		rows.resize(_rows.size());
+		for (uint i = 0; i < _rows.size(); i++)
+			memcpy(&rows[i], &(*this)[i], sizeof(TextBufferRow));
+
+		_rows = rows;
+		_head = 0;
+	}
+
+	_rows.resize(count);
+}
+
+void TextBufferWindow::TextBufferRows::clear() {
+	_rows.clear();
+	_head = 0;
+}
+
+void TextBufferWindow::TextBufferRows::rotate() {
+	_head = (_head + _rows.size() - 1) % _rows.size();
+}
+
+/*--------------------------------------------------------------------------*/
+
 TextBufferWindow::TextBufferRow::TextBufferRow() : _len(0), _newLine(0), _dirty(false),
 	_repaint(false), _lPic(nullptr), _rPic(nullptr), _lHyper(0), _rHyper(0),
 	_lm(0), _rm(0) {
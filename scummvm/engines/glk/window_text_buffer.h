@@ -53,7 +53,40 @@ class TextBufferWindow : public TextWindow, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * Ring of scrollback rows, with row 0 being the line currently being written
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _head;
+	public:
+		/**
+		 * Constructor
+		 */
+		TextBufferRows() : _head(0) {}
+
+		TextBufferRow &operator[](uint idx) { return _rows[(_head + idx) % _rows.size()]; }
+		const TextBufferRow &operator[](uint idx) const { return _rows[(_head + idx) % _rows.size()]; }
+		uint size() const { return _rows.size(); }
+
+		/**
+		 * Change the number of rows, keeping the existing ones in order
+		 */
+		void resize(uint count);
+
+		/**
+		 * Remove all the rows
+		 */
+		void clear();
+
+		/**
+		 * Move every row one place up, making the oldest row the new row 0. This is much cheaper
+		 * than copying all the scrollback on each new line.
+		 */
+		void rotate();
+	};
 private:
 	PropFontInfo &_font;
 private:
@@ -92,6 +125,21 @@ private:
 	void scrollOneLine(bool forced);
 	void scrollResize();
 	int calcWidth(const uint32 *chars, const Attributes *attrs, int startchar, int numchars, int spw);
+
+	/**
+	 * Returns the width of the first numChars characters of the current line. Widths of the line
+	 * prefixes are remembered, so adding characters one at a time only measures the new ones.
+	 */
+	int lineWidth(int numChars);
+
+	/**
+	 * Forget remembered line widths from the given character position on, after the current
+	 * line was changed there
+	 */
+	void invalidateLineWidth(int pos) {
+		if (pos < _lineWidthsValid)
+			_lineWidthsValid = pos;
+	}
 public:
 	int _width, _height;
 	int _spaced;
@@ -104,6 +152,9 @@ public:
 	uint32 *_chars;       ///< alias to lines[0].chars
 	Attributes *_attrs;   ///< alias to lines[0].attrs
 
+	int _lineWidths[TBLINELEN + 1]; ///< widths of the prefixes of lines[0]
+	int _lineWidthsValid;           ///< last valid entry of _lineWidths
+
 	///< adjust margins temporarily for images
 	int _ladjw;
 	int _ladjn;
@@ -66,7 +66,18 @@ bool Sound::isVoicePresent(const char *file) const {
 }
 
 int32 Sound::voicePlay(const char *file, Audio::SoundHandle *handle, uint8 volume, uint8 priority, bool isSfx) {
-	Audio::SeekableAudioStream *audioStream = getVoiceStream(file);
+	Audio::SeekableAudioStream *audioStream = 0;
+
+	// Sound effects are short and played over and over again, so keep them
+	// decoded instead of creating a new decoder every time
+	if (isSfx) {
+		Audio::SampleCacheKey key(file);
+		audioStream = _sampleCache.find(key);
+		if (!audioStream)
+			audioStream = _sampleCache.add(key, getVoiceStream(file));
+	} else {
+		audioStream = getVoiceStream(file);
+	}
 
 	if (!audioStream) {
 		return 0;
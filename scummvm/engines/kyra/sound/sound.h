@@ -29,6 +29,7 @@
 #include "common/str.h"
 
 #include "audio/mixer.h"
+#include "audio/samplecache.h"
 
 namespace Audio {
 class AudioStream;
@@ -307,6 +308,8 @@ protected:
 	KyraEngine_v1 *_vm;
 	Audio::Mixer *_mixer;
 
+	Audio::SampleCache _sampleCache;
+
 private:
 	struct SpeechCodecs {
 		const char *fileext;
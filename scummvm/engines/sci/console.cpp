@@ -128,6 +128,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("room",				WRAP_METHOD(Console, cmdRoomNumber));
 	registerCmd("quit",				WRAP_METHOD(Console, cmdQuit));
 	registerCmd("list_saves",			WRAP_METHOD(Console, cmdListSaves));
+	registerCmd("frame_stats",		WRAP_METHOD(Console, cmdFrameStats));
 	// Graphics
 	registerCmd("show_map",			WRAP_METHOD(Console, cmdShowMap));
 	registerCmd("set_palette",		WRAP_METHOD(Console, cmdSetPalette));
@@ -348,6 +349,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" list_saves - List all saved games including filenames\n");
 	debugPrintf(" restart_game - Restarts the game\n");
 	debugPrintf(" version - Shows the resource and interpreter versions\n");
+	debugPrintf(" frame_stats - Shows the frame time histogram of kWait, or resets it\n");
 	debugPrintf(" room - Gets or sets the current room number\n");
 	debugPrintf(" quit - Quits the game\n");
 	debugPrintf("\n");
@@ -1649,6 +1651,18 @@ bool Console::cmdListSaves(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdFrameStats(int argc, const char **argv) {
+	if (argc == 2 && !strcmp(argv[1], "reset")) {
+		_engine->_framePacer.resetStats();
+		debugPrintf("Frame statistics reset\n");
+		return true;
+	}
+
+	debugPrintf("%s", _engine->_framePacer.getStats().c_str());
+	debugPrintf("Use %s reset to clear the statistics\n", argv[0]);
+	return true;
+}
+
 bool Console::cmdClassTable(int argc, const char **argv) {
 	debugPrintf("Available classes (parse a parameter to filter the table by a specific class):\n");
 
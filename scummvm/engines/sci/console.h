@@ -83,6 +83,7 @@ private:
 	bool cmdRoomNumber(int argc, const char **argv);
 	bool cmdQuit(int argc, const char **argv);
 	bool cmdListSaves(int argc, const char **argv);
+	bool cmdFrameStats(int argc, const char **argv);
 	// Screen
 	bool cmdShowMap(int argc, const char **argv);
 	// Graphics
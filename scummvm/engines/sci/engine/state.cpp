@@ -135,17 +135,16 @@ void EngineState::speedThrottler(uint32 neededSleep) {
 }
 
 uint16 EngineState::wait(uint16 ticks) {
-	uint32 time = g_system->getMillis();
-
-	uint32 ms = ticks * 1000 / 60;
-	uint32 duration = time - lastWaitTime;
-	if (ms > duration) {
-		uint32 sleepTime = ms - duration;
-		sleepTime *= g_debug_sleeptime_factor;
-		g_sci->sleep(sleepTime);
-		time += sleepTime;
-	}
+	// The deadline is chained from the one of the previous wait with
+	// sub-millisecond precision, so that e.g. waiting for one tick every
+	// frame really runs at 60 Hz instead of 62.5 Hz.
+	Common::FramePacer &pacer = g_sci->_framePacer;
+	pacer.startFrame(ticks * g_debug_sleeptime_factor);
+	if ((int32)(pacer.getDeadline() - g_system->getMillis()) > 0)
+		g_sci->sleepUntil(pacer.getDeadline());
+	pacer.flushScreen();
 
+	uint32 time = g_system->getMillis();
 	uint16 tickDelta = (uint16)(((long)time - lastWaitTime) * 60 / 1000);
 	lastWaitTime = time;
 	return tickDelta;
@@ -375,10 +375,9 @@ SciEvent EventManager::getScummVMEvent() {
 
 void EventManager::updateScreen() {
 	// Update the screen here, since it's called very often.
-	// Throttle the screen update rate to 60fps.
+	// The frame pacer throttles the screen update rate to 60fps.
 	EngineState *s = g_sci->getEngineState();
-	if (g_system->getMillis() - s->_screenUpdateTime >= 1000 / 60) {
-		g_system->updateScreen();
+	if (g_sci->_framePacer.updateScreen()) {
 		s->_screenUpdateTime = g_system->getMillis();
 		// Throttle the checking of shouldQuit() to 60fps as well, since
 		// Engine::shouldQuit() invokes 2 virtual functions
@@ -834,9 +834,10 @@ void SciEngine::sleep(uint32 msecs) {
 		return;
 	}
 
-	uint32 time;
-	const uint32 wakeUpTime = g_system->getMillis() + msecs;
+	sleepUntil(g_system->getMillis() + msecs);
+}
 
+void SciEngine::sleepUntil(uint32 wakeUpTime) {
 	for (;;) {
 		// let backend process events and update the screen
 		_eventMan->getSciEvent(kSciEventPeek);
@@ -854,14 +855,8 @@ void SciEngine::sleep(uint32 msecs) {
 			g_sci->_gfxFrameout->updateScreen();
 		}
 #endif
-		time = g_system->getMillis();
-		if (time + 10 < wakeUpTime) {
-			g_system->delayMillis(10);
-		} else {
-			if (time < wakeUpTime)
-				g_system->delayMillis(wakeUpTime - time);
+		if (_framePacer.delayUntil(wakeUpTime, 10))
 			break;
-		}
 	}
 }
 
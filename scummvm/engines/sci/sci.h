@@ -24,6 +24,7 @@
 #define SCI_SCI_H
 
 #include "engines/engine.h"
+#include "common/frame-pacer.h"
 #include "common/macresman.h"
 #include "common/util.h"
 #include "common/random.h"
@@ -313,6 +314,7 @@ public:
 	int inQfGImportRoom() const;
 
 	void sleep(uint32 msecs);
+	void sleepUntil(uint32 wakeUpTime);
 
 	void scriptDebug();
 	bool checkExportBreakpoint(uint16 script, uint16 pubfunct);
@@ -378,6 +380,7 @@ public:
 #endif
 
 	AudioPlayer *_audio;
+	Common::FramePacer _framePacer; // Paces kWait and throttles screen updates
 	Sync *_sync;
 	SoundCommandParser *_soundCmd;
 	GameFeatures *_features;
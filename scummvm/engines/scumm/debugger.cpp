@@ -97,6 +97,8 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("imuse",     WRAP_METHOD(ScummDebugger, Cmd_IMuse));
 
 	registerCmd("resetcursors",    WRAP_METHOD(ScummDebugger, Cmd_ResetCursors));
+
+	registerCmd("framestats",      WRAP_METHOD(ScummDebugger, Cmd_FrameStats));
 }
 
 ScummDebugger::~ScummDebugger() {
@@ -842,4 +844,16 @@ bool ScummDebugger::Cmd_ResetCursors(int argc, const char **argv) {
 	return false;
 }
 
+bool ScummDebugger::Cmd_FrameStats(int argc, const char **argv) {
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		_vm->_framePacer.resetStats();
+		debugPrintf("Frame statistics reset\n");
+		return true;
+	}
+
+	debugPrintf("%s", _vm->_framePacer.getStats().c_str());
+	debugPrintf("Use %s reset to clear the statistics\n", argv[0]);
+	return true;
+}
+
 } // End of namespace Scumm
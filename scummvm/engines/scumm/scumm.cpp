@@ -2159,7 +2159,7 @@ Common::Error ScummEngine::go() {
 		}
 
 		// Wait...
-		waitForTimer(delta * 1000 / 60 - diff);
+		waitForTicks(delta);
 
 		// Start the stop watch!
 		diff = _system->getMillis();
@@ -2181,15 +2181,26 @@ Common::Error ScummEngine::go() {
 }
 
 void ScummEngine::waitForTimer(int msec_delay) {
-	uint32 start_time;
-
 	if (_fastMode & 2)
 		msec_delay = 0;
 	else if (_fastMode & 1)
 		msec_delay = 10;
 
-	start_time = _system->getMillis();
+	waitUntil(_system->getMillis() + msec_delay);
+}
+
+void ScummEngine::waitForTicks(int ticks) {
+	// The frame deadline is kept relative to the previous one, so the time
+	// spent in scummLoop and any oversleeping is accounted for
+	_framePacer.startFrame(ticks);
+
+	if (_fastMode)
+		waitForTimer(0);
+	else
+		waitUntil(_framePacer.getDeadline());
+}
 
+void ScummEngine::waitUntil(uint32 time) {
 	while (!shouldQuit()) {
 		_sound->updateCD(); // Loop CD Audio if needed
 		parseEvents();
@@ -2199,10 +2210,12 @@ void ScummEngine::waitForTimer(int msec_delay) {
 			_townsScreen->update();
 #endif
 
-		_system->updateScreen();
-		if (_system->getMillis() >= start_time + msec_delay)
+		_framePacer.updateScreen();
+		if ((int32)(time - _system->getMillis()) <= 0) {
+			_framePacer.flushScreen();
 			break;
-		_system->delayMillis(10);
+		}
+		_framePacer.delayUntil(time, 10);
 	}
 }
 
@@ -28,6 +28,7 @@
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
+#include "common/frame-pacer.h"
 #include "common/savefile.h"
 #include "common/keyboard.h"
 #include "common/random.h"
@@ -474,6 +475,8 @@ protected:
 	virtual void parseEvent(Common::Event event);
 
 	void waitForTimer(int msec_delay);
+	void waitForTicks(int ticks);
+	void waitUntil(uint32 time);
 	virtual void processInput();
 	virtual void processKeyboard(Common::KeyState lastKeyHit);
 	virtual void clearClickedStatus();
@@ -504,6 +507,7 @@ protected:
 	char displayMessage(const char *altButton, const char *message, ...) GCC_PRINTF(3, 4);
 
 	byte _fastMode;
+	Common::FramePacer _framePacer;
 
 	byte _numActors;
 	Actor **_actors;	// Has _numActors elements
@@ -41,6 +41,7 @@
 #include "audio/decoders/flac.h"
 #include "audio/mididrv.h"
 #include "audio/mixer.h"
+#include "audio/samplecache.h"
 #include "audio/decoders/mp3.h"
 #include "audio/decoders/raw.h"
 #include "audio/decoders/voc.h"
@@ -491,6 +492,7 @@ void Sound::startTalkSound(uint32 offset, uint32 b, int mode, Audio::SoundHandle
 	Common::ScopedPtr<ScummFile> file;
 
 	bool _sampleIsPCMS16BE44100 = false;
+	bool cacheSample = false;
 
 	if (_vm->_game.id == GID_CMI) {
 		_sfxMode |= mode;
@@ -626,44 +628,57 @@ void Sound::startTalkSound(uint32 offset, uint32 b, int mode, Audio::SoundHandle
 		_sfxMode |= mode;
 		_curSoundPos = 0;
 		_mouthSyncMode = true;
+
+		// Sound effects are short and played over and over again, so keep
+		// them decoded instead of creating a new decoder every time
+		cacheSample = (mode == 1 && !_vm->_imuseDigital);
 	}
 
 	if (!_soundsPaused && _mixer->isReady()) {
-		Audio::AudioStream *input = NULL;
+		Audio::SeekableAudioStream *input = NULL;
+		Audio::SampleCacheKey cacheKey(_sfxFilename, offset, _soundMode);
+		bool cacheHit = false;
+
+		if (cacheSample) {
+			input = _sampleCache.find(cacheKey);
+			cacheHit = (input != NULL);
+		}
 
-		switch (_soundMode) {
-		case kMP3Mode:
+		if (!cacheHit) {
+			switch (_soundMode) {
+			case kMP3Mode:
 #ifdef USE_MAD
-			{
-			assert(size > 0);
-			input = Audio::makeMP3Stream(new Common::SeekableSubReadStream(file.release(), offset, offset + size, DisposeAfterUse::YES), DisposeAfterUse::YES);
-			}
+				{
+				assert(size > 0);
+				input = Audio::makeMP3Stream(new Common::SeekableSubReadStream(file.release(), offset, offset + size, DisposeAfterUse::YES), DisposeAfterUse::YES);
+				}
 #endif
-			break;
-		case kVorbisMode:
+				break;
+			case kVorbisMode:
 #ifdef USE_VORBIS
-			{
-			assert(size > 0);
-			input = Audio::makeVorbisStream(new Common::SeekableSubReadStream(file.release(), offset, offset + size, DisposeAfterUse::YES), DisposeAfterUse::YES);
-			}
+				{
+				assert(size > 0);
+				input = Audio::makeVorbisStream(new Common::SeekableSubReadStream(file.release(), offset, offset + size, DisposeAfterUse::YES), DisposeAfterUse::YES);
+				}
 #endif
-			break;
-		case kFLACMode:
+				break;
+			case kFLACMode:
 #ifdef USE_FLAC
-			{
-			assert(size > 0);
-			input = Audio::makeFLACStream(new Common::SeekableSubReadStream(file.release(), offset, offset + size, DisposeAfterUse::YES), DisposeAfterUse::YES);
-			}
+				{
+				assert(size > 0);
+				input = Audio::makeFLACStream(new Common::SeekableSubReadStream(file.release(), offset, offset + size, DisposeAfterUse::YES), DisposeAfterUse::YES);
+				}
 #endif
-			break;
-		default:
-			if (_sampleIsPCMS16BE44100) {
-				offset += 32; // size of VOC header
-				input = Audio::makeRawStream(new Common::SeekableSubReadStream(file.release(), offset, offset + size, DisposeAfterUse::YES), 44100, Audio::FLAG_16BITS, DisposeAfterUse::YES);
-			} else {
-				input = Audio::makeVOCStream(file.release(), Audio::FLAG_UNSIGNED, DisposeAfterUse::YES);
+				break;
+			default:
+				if (_sampleIsPCMS16BE44100) {
+					offset += 32; // size of VOC header
+					input = Audio::makeRawStream(new Common::SeekableSubReadStream(file.release(), offset, offset + size, DisposeAfterUse::YES), 44100, Audio::FLAG_16BITS, DisposeAfterUse::YES);
+				} else {
+					input = Audio::makeVOCStream(file.release(), Audio::FLAG_UNSIGNED, DisposeAfterUse::YES);
+				}
+				break;
 			}
-			break;
 		}
 
 		if (!input) {
@@ -671,6 +686,9 @@ void Sound::startTalkSound(uint32 offset, uint32 b, int mode, Audio::SoundHandle
 			return;
 		}
 
+		if (cacheSample && !cacheHit)
+			input = _sampleCache.add(cacheKey, input);
+
 		if (_vm->_imuseDigital) {
 #ifdef ENABLE_SCUMM_7_8
 			//_vm->_imuseDigital->stopSound(kTalkSoundID);
@@ -27,6 +27,7 @@
 #include "common/serializer.h"
 #include "common/str.h"
 #include "audio/mididrv.h"
+#include "audio/samplecache.h"
 #include "backends/audiocd/audiocd.h"
 
 namespace Audio {
@@ -88,6 +89,8 @@ protected:
 	int16 _currentCDSound;
 	int16 _currentMusic;
 
+	Audio::SampleCache _sampleCache;
+
 	Audio::SoundHandle *_loomSteamCDAudioHandle;
 	bool _isLoomSteam;
 	AudioCDManager::Status _loomSteamCD;
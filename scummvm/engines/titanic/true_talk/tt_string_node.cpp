@@ -57,7 +57,7 @@ void TTstringNode::initialize(TTstringNode *oldNode) {
 
 TTstringNode *TTstringNode::findByName(const TTstring &str, VocabMode mode) {
 	for (TTstringNode *nodeP = this; nodeP; nodeP = dynamic_cast<TTstringNode *>(nodeP->_nextP)) {
-		if (nodeP->_mode == mode || (mode == VOCAB_MODE_EN && nodeP->_mode < 3)) {
+		if (nodeP->matchesMode(mode)) {
 			if (nodeP->_string == str)
 				return nodeP;
 		}
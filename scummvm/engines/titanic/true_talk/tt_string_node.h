@@ -48,6 +48,13 @@ public:
 public:
 	TTstringNode();
 
+	/**
+	 * Returns true if the node applies to the given vocab mode
+	 */
+	bool matchesMode(VocabMode mode) const {
+		return _mode == mode || (mode == VOCAB_MODE_EN && _mode < 3);
+	}
+
 	/**
 	 * Find a string node in the linked chain by name
 	 */
@@ -58,8 +58,14 @@ int TTvocab::load(const CString &name) {
 
 		switch (wordClass) {
 		case WC_UNKNOWN: {
-			if (_word)
+			if (_word) {
 				result = _word->readSyn(file);
+				if (!result) {
+					TTsynonym *synP = dynamic_cast<TTsynonym *>(_word->_synP->getTail());
+					if (synP->matchesMode(_vocabMode))
+						addIndexEntry(synP->_string, _word, synP);
+				}
+			}
 			skipFlag = true;
 			break;
 		}
@@ -148,32 +154,40 @@ void TTvocab::addWord(TTword *word) {
 	} else if (_tailP) {
 		_tailP->_nextP = word;
 		_tailP = word;
+		indexWord(word);
 	} else {
 		if (!_headP)
 			_headP = word;
 
 		_tailP = word;
+		indexWord(word);
 	}
 }
 
-TTword *TTvocab::findWord(const TTstring &str) {
-	TTsynonym *tempNode = new TTsynonym();
-	bool flag = false;
-	TTword *word = _headP;
-
-	while (word && !flag) {
-		if (_vocabMode != VOCAB_MODE_EN || strcmp(word->c_str(), str)) {
-			if (word->findSynByName(str, tempNode, _vocabMode))
-				flag = true;
-			else
-				word = word->_nextP;
-		} else {
-			flag = true;
-		}
+void TTvocab::addIndexEntry(const TTstring &str, TTword *word, TTsynonym *synP) {
+	if (!_index.contains(str.c_str()))
+		_index[str.c_str()] = VocabEntry(word, synP);
+}
+
+void TTvocab::indexWord(TTword *word) {
+	// In English mode the word text itself matches ahead of its synonyms
+	if (_vocabMode == VOCAB_MODE_EN)
+		addIndexEntry(word->_text, word, nullptr);
+
+	for (TTsynonym *synP = word->_synP; synP; synP = dynamic_cast<TTsynonym *>(synP->_nextP)) {
+		if (synP->matchesMode(_vocabMode))
+			addIndexEntry(synP->_string, word, synP);
 	}
+}
 
-	delete tempNode;
-	return word;
+const TTvocab::VocabEntry *TTvocab::findEntry(const TTstring &str) const {
+	VocabIndex::const_iterator i = _index.find(str.c_str());
+	return i == _index.end() ? nullptr : &i->_value;
+}
+
+TTword *TTvocab::findWord(const TTstring &str) {
+	const VocabEntry *entry = findEntry(str);
+	return entry ? entry->_word : nullptr;
 }
 
 TTword *TTvocab::getWord(TTstring &str, TTword **srcWord) const {
@@ -204,21 +218,21 @@ TTword *TTvocab::getPrimeWord(TTstring &str, TTword **srcWord) const {
 		newWord = new TTword(str, WC_ABSTRACT, 300);
 	} else {
 		// Standard word
-		for (vocabP = _headP; vocabP; vocabP = vocabP->_nextP) {
-			if (_vocabMode == VOCAB_MODE_EN && !strcmp(str.c_str(), vocabP->c_str())) {
-				newWord = vocabP->copy();
-				newWord->_nextP = nullptr;
-				newWord->setSyn(nullptr);
-				break;
-			} else if (vocabP->findSynByName(str, &tempSyn, _vocabMode)) {
-				// Create a copy of the word and the found synonym
-				TTsynonym *newSyn = new TTsynonym(tempSyn);
-				newSyn->_nextP = newSyn->_priorP = nullptr;
-				newWord = vocabP->copy();
-				newWord->_nextP = nullptr;
-				newWord->setSyn(newSyn);
-				break;
-			}
+		const VocabEntry *entry = findEntry(str);
+		vocabP = entry ? entry->_word : nullptr;
+
+		if (entry && !entry->_synP) {
+			newWord = vocabP->copy();
+			newWord->_nextP = nullptr;
+			newWord->setSyn(nullptr);
+		} else if (entry) {
+			// Create a copy of the word and the found synonym
+			tempSyn.copyFrom(entry->_synP);
+			TTsynonym *newSyn = new TTsynonym(tempSyn);
+			newSyn->_nextP = newSyn->_priorP = nullptr;
+			newWord = vocabP->copy();
+			newWord->_nextP = nullptr;
+			newWord->setSyn(newSyn);
 		}
 	}
 
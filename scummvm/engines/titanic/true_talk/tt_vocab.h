@@ -23,6 +23,7 @@
 #ifndef TITANIC_ST_VOCAB_H
 #define TITANIC_ST_VOCAB_H
 
+#include "common/hashmap.h"
 #include "titanic/support/exe_resources.h"
 #include "titanic/support/string.h"
 #include "titanic/true_talk/tt_string.h"
@@ -31,11 +32,20 @@
 namespace Titanic {
 
 class TTvocab {
+	struct VocabEntry {
+		TTword *_word;
+		TTsynonym *_synP;	// Matching synonym, or null if the word text matched
+
+		VocabEntry() : _word(nullptr), _synP(nullptr) {}
+		VocabEntry(TTword *word, TTsynonym *synP) : _word(word), _synP(synP) {}
+	};
+	typedef Common::HashMap<Common::String, VocabEntry> VocabIndex;
 private:
 	TTword *_headP;
 	TTword *_tailP;
 	TTword *_word;
 	VocabMode _vocabMode;
+	VocabIndex _index;
 private:
 	/**
 	 * Load the vocab data
@@ -48,7 +58,23 @@ private:
 	void addWord(TTword *word);
 
 	/**
-	 * Scans the vocab list for an existing word match
+	 * Adds a lookup string for a word to the index. As with the original
+	 * scan of the vocab list, the earliest word added for a string wins
+	 */
+	void addIndexEntry(const TTstring &str, TTword *word, TTsynonym *synP);
+
+	/**
+	 * Adds a word's text and all its synonyms to the index
+	 */
+	void indexWord(TTword *word);
+
+	/**
+	 * Looks up the word and synonym matching a passed string
+	 */
+	const VocabEntry *findEntry(const TTstring &str) const;
+
+	/**
+	 * Looks up an existing word match in the vocab index
 	 */
 	TTword *findWord(const TTstring &str);
 
@@ -116,9 +116,9 @@ void RenderManager::renderSceneToScreen() {
 	RenderTable::RenderState state = _renderTable.getRenderState();
 	if (state == RenderTable::PANORAMA || state == RenderTable::TILT) {
 		if (!_backgroundSurfaceDirtyRect.isEmpty()) {
-			_renderTable.mutateImage(&_warpedSceneSurface, in);
+			// Only the warped area that reads from changed pixels is redone
+			outWndDirtyRect = _renderTable.mutateImage(&_warpedSceneSurface, in, _backgroundSurfaceDirtyRect);
 			out = &_warpedSceneSurface;
-			outWndDirtyRect = Common::Rect(_workingWindow.width(), _workingWindow.height());
 		}
 	} else {
 		out = in;
@@ -137,14 +137,15 @@ void RenderManager::renderSceneToScreen() {
 }
 
 void RenderManager::copyToScreen(const Graphics::Surface &surface, Common::Rect &rect, int16 srcLeft, int16 srcTop) {
-	// Convert the surface to RGB565, if needed
-	Graphics::Surface *outSurface = surface.convertTo(_engine->_screenPixelFormat);
-	_system->copyRectToScreen(outSurface->getBasePtr(srcLeft, srcTop),
+	// Convert the copied area to RGB565, if needed
+	Common::Rect srcRect(srcLeft, srcTop, srcLeft + rect.width(), srcTop + rect.height());
+	Graphics::Surface *outSurface = surface.getSubArea(srcRect).convertTo(_engine->_screenPixelFormat);
+	_system->copyRectToScreen(outSurface->getPixels(),
 		                        outSurface->pitch,
 		                        rect.left,
 		                        rect.top,
-		                        rect.width(),
-		                        rect.height());
+		                        outSurface->w,
+		                        outSurface->h);
 	outSurface->free();
 	delete outSurface;
 }
@@ -786,6 +787,8 @@ void RenderManager::deleteEffect(uint32 ID) {
 		if ((*it)->getKey() == ID) {
 			delete *it;
 			it = _effects.erase(it);
+			// Redraw the area the effect used to cover
+			markDirty();
 		}
 	}
 }
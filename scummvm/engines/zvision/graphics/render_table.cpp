@@ -32,17 +32,28 @@ namespace ZVision {
 RenderTable::RenderTable(uint numColumns, uint numRows)
 	: _numRows(numRows),
 	  _numColumns(numColumns),
+	  _fullWarpNeeded(true),
 	  _renderState(FLAT) {
 	assert(numRows != 0 && numColumns != 0);
 
-	_internalBuffer = new Common::Point[numRows * numColumns];
+	_sourceIndices = new uint32[numRows * numColumns];
+	_columnSourceMinX = new int16[numColumns];
+	_columnSourceMaxX = new int16[numColumns];
+	_rowSourceMinY = new int16[numRows];
+	_rowSourceMaxY = new int16[numRows];
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
+
+	generateFlatLookupTable();
 }
 
 RenderTable::~RenderTable() {
-	delete[] _internalBuffer;
+	delete[] _sourceIndices;
+	delete[] _columnSourceMinX;
+	delete[] _columnSourceMaxX;
+	delete[] _rowSourceMinY;
+	delete[] _rowSourceMaxY;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
@@ -74,59 +85,67 @@ const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Poi
 		return Common::Point(x, y);
 	}
 
-	uint32 index = point.y * _numColumns + point.x;
-
-	Common::Point newPoint(point);
-	newPoint.x += _internalBuffer[index].x;
-	newPoint.y += _internalBuffer[index].y;
+	uint32 sourceIndex = _sourceIndices[point.y * _numColumns + point.x];
 
-	return newPoint;
+	return Common::Point(sourceIndex % _numColumns, sourceIndex / _numColumns);
 }
 
-void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
-	uint32 destOffset = 0;
-
-	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
-
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
+Common::Rect RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &srcDirtyRect) {
+	Common::Rect warpedRect;
+	if (_fullWarpNeeded) {
+		warpedRect = Common::Rect(_numColumns, _numRows);
+		_fullWarpNeeded = false;
+	} else {
+		warpedRect = getWarpedRect(srcDirtyRect);
+	}
+	warpedRect.clip(dstBuf->w, dstBuf->h);
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+	const uint16 *sourceBuffer = (const uint16 *)srcBuf->getPixels();
 
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-		}
+	for (int16 y = warpedRect.top; y < warpedRect.bottom; ++y) {
+		const uint32 *sourceIndices = _sourceIndices + y * _numColumns;
+		uint16 *destBuffer = (uint16 *)dstBuf->getBasePtr(0, y);
 
-		destOffset += destWidth;
+		for (int16 x = warpedRect.left; x < warpedRect.right; ++x)
+			destBuffer[x] = sourceBuffer[sourceIndices[x]];
 	}
-}
-
-void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
 
-	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
-	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
-
-	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+	return warpedRect;
+}
 
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
+Common::Rect RenderTable::getWarpedRect(const Common::Rect &srcRect) const {
+	if (srcRect.isEmpty())
+		return Common::Rect();
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+	// A warped pixel can only read from srcRect if both its column and its row
+	// read from inside it somewhere, so this gives a conservative bounding box.
+	int16 left = -1, right = -1;
+	for (uint x = 0; x < _numColumns; ++x) {
+		if (_columnSourceMinX[x] < srcRect.right && _columnSourceMaxX[x] >= srcRect.left) {
+			if (left < 0)
+				left = x;
+			right = x + 1;
+		}
+	}
 
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
+	int16 top = -1, bottom = -1;
+	for (uint y = 0; y < _numRows; ++y) {
+		if (_rowSourceMinY[y] < srcRect.bottom && _rowSourceMaxY[y] >= srcRect.top) {
+			if (top < 0)
+				top = y;
+			bottom = y + 1;
 		}
 	}
+
+	if (left < 0 || top < 0)
+		return Common::Rect();
+
+	return Common::Rect(left, top, right, bottom);
 }
 
 void RenderTable::generateRenderTable() {
+	_fullWarpNeeded = true;
+
 	switch (_renderState) {
 	case ZVision::RenderTable::PANORAMA:
 		generatePanoramaLookupTable();
@@ -140,21 +159,29 @@ void RenderTable::generateRenderTable() {
 	}
 }
 
-void RenderTable::generatePanoramaLookupTable() {
-	for (uint y = 0; y < _numRows; y++) {
-		for (uint x = 0; x < _numColumns; x++) {
-			uint32 index = y * _numColumns + x;
-			_internalBuffer[index].x = 0;
-			_internalBuffer[index].y = 0;
-		}
+void RenderTable::generateFlatLookupTable() {
+	uint32 index = 0;
+	for (uint y = 0; y < _numRows; ++y) {
+		for (uint x = 0; x < _numColumns; ++x, ++index)
+			_sourceIndices[index] = index;
 	}
 
+	// Every column and row reads from itself only
+	for (uint x = 0; x < _numColumns; ++x)
+		_columnSourceMinX[x] = _columnSourceMaxX[x] = x;
+	for (uint y = 0; y < _numRows; ++y)
+		_rowSourceMinY[y] = _rowSourceMaxY[y] = y;
+}
+
+void RenderTable::generatePanoramaLookupTable() {
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
 
 	float fovInRadians = Common::deg2rad<float>(_panoramaOptions.fieldOfView);
 	float cylinderRadius = halfHeight / tan(fovInRadians);
 
+	resetSourceBounds();
+
 	for (uint x = 0; x < _numColumns; ++x) {
 		// Add an offset of 0.01 to overcome zero tan/atan issue (vertical line on half of screen)
 		// Alpha represents the horizontal angle between the viewer at the center of a cylinder and x
@@ -173,9 +200,8 @@ void RenderTable::generatePanoramaLookupTable() {
 
 			uint32 index = y * _numColumns + x;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			_sourceIndices[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
+			extendSourceBounds(x, y, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
@@ -188,6 +214,8 @@ void RenderTable::generateTiltLookupTable() {
 	float cylinderRadius = halfWidth / tan(fovInRadians);
 	_tiltOptions.gap = cylinderRadius * atan2((float)(halfHeight / cylinderRadius), 1.0f) * _tiltOptions.linearScale;
 
+	resetSourceBounds();
+
 	for (uint y = 0; y < _numRows; ++y) {
 
 		// Add an offset of 0.01 to overcome zero tan/atan issue (horizontal line on half of screen)
@@ -208,13 +236,23 @@ void RenderTable::generateTiltLookupTable() {
 
 			uint32 index = columnIndex + x;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			_sourceIndices[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
+			extendSourceBounds(x, y, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
 
+void RenderTable::resetSourceBounds() {
+	for (uint x = 0; x < _numColumns; ++x) {
+		_columnSourceMinX[x] = _numColumns;
+		_columnSourceMaxX[x] = -1;
+	}
+	for (uint y = 0; y < _numRows; ++y) {
+		_rowSourceMinY[y] = _numRows;
+		_rowSourceMaxY[y] = -1;
+	}
+}
+
 void RenderTable::setPanoramaFoV(float fov) {
 	assert(fov > 0.0f);
 
@@ -42,7 +42,17 @@ public:
 
 private:
 	uint _numColumns, _numRows;
-	Common::Point *_internalBuffer;
+	/**
+	 * For every warped pixel, the index of the flat pixel it is read from.
+	 * Storing absolute indices turns the warp into a plain indexed copy.
+	 */
+	uint32 *_sourceIndices;
+	// Range of source columns read by each warped column, and of source rows
+	// read by each warped row. Used to find the warped area a change touches.
+	int16 *_columnSourceMinX, *_columnSourceMaxX;
+	int16 *_rowSourceMinY, *_rowSourceMaxY;
+	// The table changed since the last warp, so all of it has to be redone
+	bool _fullWarpNeeded;
 	RenderState _renderState;
 
 	struct {
@@ -68,8 +78,13 @@ public:
 
 	const Common::Point convertWarpedCoordToFlatCoord(const Common::Point &point);
 
-	void mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect);
-	void mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf);
+	/**
+	 * Warp only the part of srcBuf that can be affected by changes inside
+	 * srcDirtyRect, reusing the rest of the previous contents of dstBuf.
+	 *
+	 * @return the area of dstBuf that was updated
+	 */
+	Common::Rect mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &srcDirtyRect);
 	void generateRenderTable();
 
 	void setPanoramaFoV(float fov);
@@ -88,8 +103,17 @@ public:
 	float getLinscale();
 
 private:
+	void generateFlatLookupTable();
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
+	void resetSourceBounds();
+	void extendSourceBounds(uint x, uint y, int16 sourceX, int16 sourceY) {
+		_columnSourceMinX[x] = MIN(_columnSourceMinX[x], sourceX);
+		_columnSourceMaxX[x] = MAX(_columnSourceMaxX[x], sourceX);
+		_rowSourceMinY[y] = MIN(_rowSourceMinY[y], sourceY);
+		_rowSourceMaxY[y] = MAX(_rowSourceMaxY[y], sourceY);
+	}
+	Common::Rect getWarpedRect(const Common::Rect &srcRect) const;
 };
 
 } // End of namespace ZVision
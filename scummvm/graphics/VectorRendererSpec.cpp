@@ -605,11 +605,22 @@ precalcGradient(int h) {
 template<typename PixelType>
 void VectorRendererSpec<PixelType>::
 gradientFill(PixelType *ptr, int width, int x, int y) {
+	if (width <= 0)
+		return;
+
 	bool ox = ((y & 1) == 1);
-	int curGrad = 0;
 
-	while (_gradIndexes[curGrad + 1] <= y)
-		curGrad++;
+	// Find the strip containing y. Strips are sorted and tall gradients have
+	// one strip per row, so search instead of scanning from the top.
+	int curGrad = 0;
+	int lastGrad = _gradIndexes.size() - 2;
+	while (curGrad < lastGrad) {
+		int mid = (curGrad + lastGrad) / 2;
+		if (_gradIndexes[mid + 1] <= y)
+			curGrad = mid + 1;
+		else
+			lastGrad = mid;
+	}
 
 	// precalcGradient assures that _gradIndexes entries always differ in
 	// their value. This assures stripSize is always different from zero.
@@ -630,16 +641,20 @@ gradientFill(PixelType *ptr, int width, int x, int y) {
 	} else if (grad == 3 && ox) {
 		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1]);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			bool oy = ((j & 1) == 1);
+		// The dithering pattern of a row only depends on the column parity
+		const PixelType even = (ox && (grad == 2 || grad == 3)) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+		const PixelType odd = (ox || grad == 3) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
 
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
+		const PixelType first = (x & 1) ? odd : even;
+		const PixelType second = (x & 1) ? even : odd;
+		PixelType *end = ptr + width;
+
+		for (; ptr + 1 < end; ptr += 2) {
+			ptr[0] = first;
+			ptr[1] = second;
 		}
+		if (ptr != end)
+			*ptr = first;
 	}
 }
 
@@ -647,45 +662,57 @@ template<typename PixelType>
 void VectorRendererSpec<PixelType>::
 gradientFillClip(PixelType *ptr, int width, int x, int y, int realX, int realY) {
 	if (realY < _clippingArea.top || realY >= _clippingArea.bottom) return;
-	bool ox = ((y & 1) == 1);
-	int curGrad = 0;
 
-	while (_gradIndexes[curGrad + 1] <= y)
-		curGrad++;
+	int skip = MAX(_clippingArea.left - realX, 0);
+	int count = MIN<int>(width, _clippingArea.right - realX);
+	if (count <= skip)
+		return;
 
-	// precalcGradient assures that _gradIndexes entries always differ in
-	// their value. This assures stripSize is always different from zero.
-	int stripSize = _gradIndexes[curGrad + 1] - _gradIndexes[curGrad];
+	gradientFill(ptr + skip, count - skip, x + skip, y);
+}
 
-	int grad = (((y - _gradIndexes[curGrad]) % stripSize) << 2) / stripSize;
+template<typename PixelType>
+void VectorRendererSpec<PixelType>::
+blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
+	if (first >= last)
+		return;
 
-	// Dithering:
-	//   +--+ +--+ +--+ +--+
-	//   |  | |  | | *| | *|
-	//   |  | | *| |* | |**|
-	//   +--+ +--+ +--+ +--+
-	//     0    1    2    3
-	if (grad == 0 ||
-		_gradCache[curGrad] == _gradCache[curGrad + 1] || // no color change
-		stripSize < 2) { // the stip is small
-		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad]);
-	} else if (grad == 3 && ox) {
-		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1]);
-	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			if (realX + j - x < _clippingArea.left || realX + j - x >= _clippingArea.right) continue;
-			bool oy = ((j & 1) == 1);
-
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
+	if (alpha == 0xff) {
+		colorFill<PixelType>(first, last, color | _alphaMask);
+		return;
+	}
+
+	// Spans mostly cover flat areas, so reuse the previous result as long
+	// as the destination pixel stays the same.
+	PixelType prevDst = *first;
+	blendPixelPtr(first, color, alpha);
+	PixelType prevResult = *first++;
+
+	for (; first != last; ++first) {
+		if (*first != prevDst) {
+			prevDst = *first;
+			blendPixelPtr(first, color, alpha);
+			prevResult = *first;
+		} else {
+			*first = prevResult;
 		}
 	}
 }
 
+template<typename PixelType>
+void VectorRendererSpec<PixelType>::
+blendFillClip(PixelType *first, PixelType *last, PixelType color, uint8 alpha, int realX, int realY) {
+	if (realY < _clippingArea.top || realY >= _clippingArea.bottom)
+		return;
+
+	int skip = MAX(_clippingArea.left - realX, 0);
+	int count = MIN<int>(last - first, _clippingArea.right - realX);
+	if (count <= skip)
+		return;
+
+	blendFill(first + skip, first + count, color, alpha);
+}
+
 template<typename PixelType>
 void VectorRendererSpec<PixelType>::
 fillSurface() {
@@ -2424,8 +2451,9 @@ drawBevelSquareAlgClip(int x, int y, int w, int h, int bevel, PixelType top_colo
 		}
 	} else {
 		while (i-- ) {
-			blendFillClip(ptr_left, ptr_left + w, ptr_x, ptr_y, _bgColor, 200);
+			blendFillClip(ptr_left, ptr_left + w, _bgColor, 200, ptr_x, ptr_y);
 			ptr_left += pitch;
+			++ptr_y;
 		}
 	}
 
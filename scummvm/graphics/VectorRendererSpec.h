@@ -288,22 +288,8 @@ protected:
 	 * @param color Color of the pixel
 	 * @param alpha Alpha intensity of the pixel (0-255)
 	 */
-	inline void blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
-		while (first != last)
-			blendPixelPtr(first++, color, alpha);
-	}
-
-	inline void blendFillClip(PixelType *first, PixelType *last, PixelType color, uint8 alpha, int realX, int realY) {
-		if (_clippingArea.top <= realY && realY < _clippingArea.bottom) {
-			while (first != last) {
-				if (_clippingArea.left <= realX && realX < _clippingArea.right)
-					blendPixelPtr(first++, color, alpha);
-				else
-					++first;
-				++realX;
-			}
-		}
-	}
+	void blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha);
+	void blendFillClip(PixelType *first, PixelType *last, PixelType color, uint8 alpha, int realX, int realY);
 
 	void darkenFill(PixelType *first, PixelType *last);
 	void darkenFillClip(PixelType *first, PixelType *last, int x, int y);
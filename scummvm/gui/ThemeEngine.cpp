@@ -37,6 +37,7 @@
 #include "graphics/fonts/ttf.h"
 
 #include "image/bmp.h"
+#include "image/imagecache.h"
 #include "image/png.h"
 
 #include "gui/widget.h"
@@ -87,6 +88,12 @@ struct WidgetDrawData {
 
 	DrawLayer _layer;
 
+	/**
+	 * Whether the result of drawing this item only depends on its steps, and
+	 * not on colors left in the vector renderer by earlier drawing.
+	 */
+	bool _cacheable;
+
 
 	/**
 	 * Calculates the background threshold offset of a given DrawData item.
@@ -96,6 +103,9 @@ struct WidgetDrawData {
 	 * value will be added when restoring the background of the widget.
 	 */
 	void calcBackgroundOffset();
+
+	/** Sets _cacheable after all DrawSteps have been loaded. */
+	void calcCacheable();
 };
 
 /**********************************************************
@@ -165,11 +175,11 @@ static const DrawDataInfo kDrawDataDefaults[] = {
 /**********************************************************
  * ThemeEngine class
  *********************************************************/
-ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
+ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode, Image::ImageCache *imageCache) :
 	_system(0), _vectorRenderer(0),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
-	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
-	_cursor(0) {
+	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(), _imageCache(imageCache),
+	_cursor(0), _drawCacheSize(0), _drawCacheCounter(0), _drawCacheHits(0), _drawCacheMisses(0) {
 
 	_system = g_system;
 	_parser = new ThemeParser(this);
@@ -212,6 +222,8 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 }
 
 ThemeEngine::~ThemeEngine() {
+	clearDrawCache();
+
 	delete _vectorRenderer;
 	_vectorRenderer = 0;
 	_screen.free();
@@ -429,6 +441,9 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	uint32 width = _system->getOverlayWidth();
 	uint32 height = _system->getOverlayHeight();
 
+	// The cached results belong to the old surfaces and renderer
+	clearDrawCache();
+
 	_backBuffer.free();
 	_backBuffer.create(width, height, _overlayFormat);
 
@@ -461,6 +476,31 @@ void WidgetDrawData::calcBackgroundOffset() {
 	_shadowOffset = maxShadow;
 }
 
+void WidgetDrawData::calcCacheable() {
+	_cacheable = true;
+
+	for (Common::List<Graphics::DrawStep>::const_iterator step = _steps.begin();
+	        step != _steps.end(); ++step) {
+		if (step->drawingCall == &Graphics::VectorRenderer::drawCallback_VOID ||
+		        step->drawingCall == &Graphics::VectorRenderer::drawCallback_BITMAP ||
+		        step->drawingCall == &Graphics::VectorRenderer::drawCallback_ALPHABITMAP)
+			continue;
+
+		bool colorsSet = step->fgColor.set;
+		if (step->fillMode == Graphics::VectorRenderer::kFillBackground)
+			colorsSet = colorsSet && step->bgColor.set;
+		else if (step->fillMode == Graphics::VectorRenderer::kFillGradient)
+			colorsSet = colorsSet && step->gradColor1.set && step->gradColor2.set;
+		if (step->bevel)
+			colorsSet = colorsSet && step->bevelColor.set;
+
+		if (!colorsSet) {
+			_cacheable = false;
+			return;
+		}
+	}
+}
+
 void ThemeEngine::restoreBackground(Common::Rect r) {
 	if (_vectorRenderer->getActiveSurface() == &_backBuffer) {
 		// Only restore the background when drawing to the screen surface
@@ -575,6 +615,47 @@ bool ThemeEngine::addTextColor(TextColor colorId, int r, int g, int b) {
 	return true;
 }
 
+const Graphics::Surface *ThemeEngine::decodeBitmap(const Common::String &filename, Image::ImageDecoder &decoder, bool mustDecode) {
+	Common::ArchiveMemberList members;
+	_themeFiles.listMatchingMembers(members, filename);
+	for (Common::ArchiveMemberList::const_iterator i = members.begin(), end = members.end(); i != end; ++i) {
+		// The theme file and the member name identify the image, so a hit
+		// does not have to open, and possibly inflate, the member at all
+		const Common::String cacheKey = _themeFile + ':' + (*i)->getName();
+
+		if (_imageCache) {
+			const Image::CachedImage *image = _imageCache->findImage(cacheKey);
+			if (image)
+				return &image->surface;
+		}
+
+		Common::SeekableReadStream *stream = (*i)->createReadStream();
+		if (!stream)
+			continue;
+
+		if (_imageCache) {
+			const Image::CachedImage *image = _imageCache->addImage(cacheKey, *stream, decoder);
+			delete stream;
+
+			if (image)
+				return &image->surface;
+			if (mustDecode)
+				error("Error decoding '%s'", filename.c_str());
+			continue;
+		}
+
+		if (!decoder.loadStream(*stream) && mustDecode)
+			error("Error decoding '%s'", filename.c_str());
+		delete stream;
+
+		const Graphics::Surface *srcSurface = decoder.getSurface();
+		if (srcSurface)
+			return srcSurface;
+	}
+
+	return 0;
+}
+
 bool ThemeEngine::addBitmap(const Common::String &filename) {
 	// Nothing has to be done if the bitmap already has been loaded.
 	Graphics::Surface *surf = _bitmaps[filename];
@@ -587,20 +668,7 @@ bool ThemeEngine::addBitmap(const Common::String &filename) {
 		// Maybe it is PNG?
 #ifdef USE_PNG
 		Image::PNGDecoder decoder;
-		Common::ArchiveMemberList members;
-		_themeFiles.listMatchingMembers(members, filename);
-		for (Common::ArchiveMemberList::const_iterator i = members.begin(), end = members.end(); i != end; ++i) {
-			Common::SeekableReadStream *stream = (*i)->createReadStream();
-			if (stream) {
-				if (!decoder.loadStream(*stream))
-					error("Error decoding PNG");
-
-				srcSurface = decoder.getSurface();
-				delete stream;
-				if (srcSurface)
-					break;
-			}
-		}
+		srcSurface = decodeBitmap(filename, decoder, true);
 
 		if (srcSurface && srcSurface->format.bytesPerPixel != 1)
 			surf = srcSurface->convertTo(_overlayFormat);
@@ -610,18 +678,7 @@ bool ThemeEngine::addBitmap(const Common::String &filename) {
 	} else {
 		// If not, try to load the bitmap via the BitmapDecoder class.
 		Image::BitmapDecoder bitmapDecoder;
-		Common::ArchiveMemberList members;
-		_themeFiles.listMatchingMembers(members, filename);
-		for (Common::ArchiveMemberList::const_iterator i = members.begin(), end = members.end(); i != end; ++i) {
-			Common::SeekableReadStream *stream = (*i)->createReadStream();
-			if (stream) {
-				bitmapDecoder.loadStream(*stream);
-				srcSurface = bitmapDecoder.getSurface();
-				delete stream;
-				if (srcSurface)
-					break;
-			}
-		}
+		srcSurface = decodeBitmap(filename, bitmapDecoder, false);
 
 		if (srcSurface && srcSurface->format.bytesPerPixel != 1)
 			surf = srcSurface->convertTo(_overlayFormat);
@@ -639,31 +696,17 @@ bool ThemeEngine::addAlphaBitmap(const Common::String &filename) {
 	if (surf)
 		return true;
 
-#ifdef USE_PNG
-	const Graphics::TransparentSurface *srcSurface = 0;
-#endif
-
 	if (filename.hasSuffix(".png")) {
 		// Maybe it is PNG?
 #ifdef USE_PNG
 		Image::PNGDecoder decoder;
-		Common::ArchiveMemberList members;
-		_themeFiles.listMatchingMembers(members, filename);
-		for (Common::ArchiveMemberList::const_iterator i = members.begin(), end = members.end(); i != end; ++i) {
-			Common::SeekableReadStream *stream = (*i)->createReadStream();
-			if (stream) {
-				if (!decoder.loadStream(*stream))
-					error("Error decoding PNG");
-
-				srcSurface = new Graphics::TransparentSurface(*decoder.getSurface(), true);
-				delete stream;
-				if (srcSurface)
-					break;
-			}
-		}
+		const Graphics::Surface *decoded = decodeBitmap(filename, decoder, true);
 
-		if (srcSurface && srcSurface->format.bytesPerPixel != 1)
-			surf = srcSurface->convertTo(_overlayFormat);
+		if (decoded && decoded->format.bytesPerPixel != 1) {
+			// Only wraps the decoded pixels, convertTo() makes the copy
+			const Graphics::TransparentSurface srcSurface(*decoded);
+			surf = srcSurface.convertTo(_overlayFormat);
+		}
 #else
 		error("No PNG support compiled in");
 #endif
@@ -719,6 +762,7 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 			warning("Missing data asset: '%s'", kDrawDataDefaults[i].name);
 		} else {
 			_widgets[i]->calcBackgroundOffset();
+			_widgets[i]->calcCacheable();
 		}
 	}
 }
@@ -727,6 +771,8 @@ void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	clearDrawCache();
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = 0;
@@ -865,6 +911,11 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		extendedRect.bottom += drawData->_shadowOffset - drawData->_backgroundOffset;
 	}
 
+	// Only cache drawing which isn't cut by the clipping rectangle
+	Common::Rect cacheRect = extendedRect;
+	cacheRect.clip(_screen.w, _screen.h);
+	bool cacheable = drawData->_cacheable && !area.isEmpty() && (_clip.isEmpty() || _clip.contains(cacheRect));
+
 	if (!_clip.isEmpty()) {
 		extendedRect.clip(_clip);
 	}
@@ -873,15 +924,110 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		restoreBackground(extendedRect);
 
 	if (drawData->_layer == _layerToDraw) {
-		Common::List<Graphics::DrawStep>::const_iterator step;
-		for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
-			_vectorRenderer->drawStepClip(area, _clip, *step, dynamic);
+		Graphics::Surface *surface = _vectorRenderer->getActiveSurface();
+		const uint rowSize = cacheRect.width() * surface->format.bytesPerPixel;
+		const uint entrySize = 2 * rowSize * cacheRect.height();
+		if (entrySize > kDrawCacheBudget / 4)
+			cacheable = false;
+
+		DrawCacheEntry *entry = cacheable ? findDrawCacheEntry(type, area, dynamic, surface) : nullptr;
+		if (entry) {
+			for (int y = 0; y < cacheRect.height() && entry; ++y) {
+				if (memcmp(surface->getBasePtr(cacheRect.left, cacheRect.top + y), entry->before.getBasePtr(0, y), rowSize))
+					entry = nullptr;
+			}
+		}
+
+		if (entry) {
+			// Same item over the same pixels, replay the result
+			surface->copyRectToSurface(entry->after, cacheRect.left, cacheRect.top, Common::Rect(cacheRect.width(), cacheRect.height()));
+			entry->lastUsed = ++_drawCacheCounter;
+			_drawCacheHits++;
+		} else {
+			if (cacheable) {
+				entry = new DrawCacheEntry();
+				entry->type = type;
+				entry->dynamic = dynamic;
+				entry->surface = surface;
+				entry->area = area;
+				entry->rect = cacheRect;
+				entry->before.copyFrom(surface->getSubArea(cacheRect));
+			}
+
+			Common::List<Graphics::DrawStep>::const_iterator step;
+			for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
+				_vectorRenderer->drawStepClip(area, _clip, *step, dynamic);
+			}
+
+			if (entry) {
+				entry->after.copyFrom(surface->getSubArea(cacheRect));
+				addDrawCacheEntry(entry);
+			}
+			_drawCacheMisses++;
 		}
 
 		addDirtyRect(extendedRect);
 	}
 }
 
+ThemeEngine::DrawCacheEntry *ThemeEngine::findDrawCacheEntry(DrawData type, const Common::Rect &area, uint32 dynamic, const Graphics::Surface *surface) {
+	for (uint i = 0; i < _drawCache.size(); ++i) {
+		DrawCacheEntry *entry = _drawCache[i];
+		if (entry->type == type && entry->area == area && entry->dynamic == dynamic && entry->surface == surface)
+			return entry;
+	}
+
+	return nullptr;
+}
+
+void ThemeEngine::addDrawCacheEntry(DrawCacheEntry *entry) {
+	// Replace an older result for the same item, its background changed
+	for (uint i = 0; i < _drawCache.size(); ++i) {
+		DrawCacheEntry *old = _drawCache[i];
+		if (old->type == entry->type && old->area == entry->area && old->dynamic == entry->dynamic && old->surface == entry->surface) {
+			_drawCacheSize -= old->before.pitch * old->before.h + old->after.pitch * old->after.h;
+			old->before.free();
+			old->after.free();
+			delete old;
+			_drawCache.remove_at(i);
+			break;
+		}
+	}
+
+	const uint32 size = entry->before.pitch * entry->before.h + entry->after.pitch * entry->after.h;
+
+	// Evict the least recently used results until the new one fits
+	while (!_drawCache.empty() && (_drawCacheSize + size > kDrawCacheBudget || _drawCache.size() >= kDrawCacheMaxEntries)) {
+		uint oldest = 0;
+		for (uint i = 1; i < _drawCache.size(); ++i) {
+			if (_drawCache[i]->lastUsed < _drawCache[oldest]->lastUsed)
+				oldest = i;
+		}
+
+		DrawCacheEntry *old = _drawCache[oldest];
+		_drawCacheSize -= old->before.pitch * old->before.h + old->after.pitch * old->after.h;
+		old->before.free();
+		old->after.free();
+		delete old;
+		_drawCache.remove_at(oldest);
+	}
+
+	entry->lastUsed = ++_drawCacheCounter;
+	_drawCache.push_back(entry);
+	_drawCacheSize += size;
+}
+
+void ThemeEngine::clearDrawCache() {
+	for (uint i = 0; i < _drawCache.size(); ++i) {
+		_drawCache[i]->before.free();
+		_drawCache[i]->after.free();
+		delete _drawCache[i];
+	}
+
+	_drawCache.clear();
+	_drawCacheSize = 0;
+}
+
 void ThemeEngine::drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::String &text,
                              bool restoreBg, bool ellipsis, Graphics::TextAlign alignH, TextAlignVertical alignV,
                              int deltax, const Common::Rect &drawableTextArea) {
@@ -26,6 +26,7 @@
 #include "common/scummsys.h"
 #include "common/fs.h"
 #include "common/hash-str.h"
+#include "common/array.h"
 #include "common/hashmap.h"
 #include "common/list.h"
 #include "common/str.h"
@@ -46,6 +47,11 @@ struct DrawStep;
 class VectorRenderer;
 }
 
+namespace Image {
+class ImageCache;
+class ImageDecoder;
+}
+
 namespace GUI {
 
 struct WidgetDrawData;
@@ -293,8 +299,13 @@ public:
 	static GraphicsMode findMode(const Common::String &cfg);
 	static const char *findModeConfigName(GraphicsMode mode);
 
-	/** Default constructor */
-	ThemeEngine(Common::String id, GraphicsMode mode);
+	/**
+	 * Default constructor
+	 *
+	 * @param imageCache    optional cache for the decoded theme bitmaps, to
+	 *                      share them with later ThemeEngine instances.
+	 */
+	ThemeEngine(Common::String id, GraphicsMode mode, Image::ImageCache *imageCache = 0);
 
 	/** Default destructor */
 	~ThemeEngine();
@@ -541,6 +552,15 @@ protected:
 	 */
 	void setGraphicsMode(GraphicsMode mode);
 
+	/**
+	 * Decode a bitmap from the theme files, through the image cache if there
+	 * is one.
+	 *
+	 * @param mustDecode    whether failing to decode an existing file is fatal.
+	 * @return the decoded surface, owned by the decoder or the cache.
+	 */
+	const Graphics::Surface *decodeBitmap(const Common::String &filename, Image::ImageDecoder &decoder, bool mustDecode);
+
 public:
 	inline ThemeEval *getEvaluator() { return _themeEval; }
 	inline Graphics::VectorRenderer *renderer() { return _vectorRenderer; }
@@ -629,6 +649,9 @@ protected:
 	 * These functions are called from all the Widget drawing methods.
 	 */
 	void drawDD(DrawData type, const Common::Rect &r, uint32 dynamic = 0, bool forceRestore = false);
+
+	/** Forget all rendered DrawData results, see drawDD(). */
+	void clearDrawCache();
 	void drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::String &text, bool restoreBg,
 	                bool elipsis, Graphics::TextAlign alignH = Graphics::kTextAlignLeft,
 	                TextAlignVertical alignV = kTextAlignVTop, int deltax = 0,
@@ -728,6 +751,8 @@ protected:
 	Common::Archive *_themeArchive;
 	Common::SearchSet _themeFiles;
 
+	Image::ImageCache *_imageCache;
+
 	bool _useCursor;
 	int _cursorHotspotX, _cursorHotspotY;
 	enum {
@@ -739,6 +764,44 @@ protected:
 	byte _cursorPalSize;
 
 	Common::Rect _clip;
+
+	/**
+	 * Rendered result of a DrawData item. Replayed by drawDD() when the same
+	 * item is drawn again at the same place over the same pixels, which
+	 * makes the result independent of any blending with the background.
+	 */
+	struct DrawCacheEntry {
+		DrawData type;
+		uint32 dynamic;
+		const Graphics::Surface *surface;
+		Common::Rect area;
+		Common::Rect rect;          ///< Part of the surface touched by the drawing
+		Graphics::Surface before;   ///< Pixels of rect before drawing
+		Graphics::Surface after;    ///< Pixels of rect after drawing
+		uint32 lastUsed;
+	};
+
+	enum {
+		kDrawCacheBudget = 16 * 1024 * 1024, ///< Bytes of pixel data kept in _drawCache
+		kDrawCacheMaxEntries = 256
+	};
+
+	Common::Array<DrawCacheEntry *> _drawCache;
+	uint32 _drawCacheSize;
+	uint32 _drawCacheCounter;
+
+	uint32 _drawCacheHits;
+	uint32 _drawCacheMisses;
+
+	DrawCacheEntry *findDrawCacheEntry(DrawData type, const Common::Rect &area, uint32 dynamic, const Graphics::Surface *surface);
+	void addDrawCacheEntry(DrawCacheEntry *entry);
+
+public:
+	/** Number of drawDD() calls replayed from the cache since the last resetDrawStats(). */
+	uint32 getDrawCacheHits() const { return _drawCacheHits; }
+	/** Number of drawDD() calls rendered by the vector renderer since the last resetDrawStats(). */
+	uint32 getDrawCacheMisses() const { return _drawCacheMisses; }
+	void resetDrawStats() { _drawCacheHits = _drawCacheMisses = 0; }
 };
 
 } // End of namespace GUI.
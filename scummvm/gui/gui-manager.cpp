@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/debug.h"
 #include "common/events.h"
 #include "common/system.h"
 #include "common/util.h"
@@ -162,7 +163,7 @@ bool GuiManager::loadNewTheme(Common::String id, ThemeEngine::GraphicsMode gfx,
 		gfx = ThemeEngine::_defaultRendererMode;
 
 	// Try to load the new theme
-	newTheme = new ThemeEngine(id, gfx);
+	newTheme = new ThemeEngine(id, gfx, &_imageCache);
 	assert(newTheme);
 
 	if (!newTheme->init())
@@ -223,6 +224,9 @@ void GuiManager::redraw() {
 	if (_redrawStatus == kRedrawOpenDialog && _dialogStack.size() > 3)
 		shading = ThemeEngine::kShadingNone;
 
+	const uint32 redrawStart = _system->getMillis(true);
+	_theme->resetDrawStats();
+
 	switch (_redrawStatus) {
 		case kRedrawCloseDialog:
 		case kRedrawFull:
@@ -267,6 +271,9 @@ void GuiManager::redraw() {
 
 	_theme->updateScreen();
 	_redrawStatus = kRedrawDisabled;
+
+	debug(8, "GUI redraw took %u ms, %u of %u widget draws cached", _system->getMillis(true) - redrawStart,
+	      _theme->getDrawCacheHits(), _theme->getDrawCacheHits() + _theme->getDrawCacheMisses());
 }
 
 Dialog *GuiManager::getTopDialog() const {
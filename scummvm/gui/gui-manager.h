@@ -31,6 +31,8 @@
 
 #include "gui/ThemeEngine.h"
 
+#include "image/imagecache.h"
+
 class OSystem;
 
 namespace Graphics {
@@ -124,6 +126,9 @@ protected:
 
 	ThemeEngine		*_theme;
 
+	// Decoded theme bitmaps, kept across theme and graphics mode reloads
+	Image::ImageCache	_imageCache;
+
 //	bool		_needRedraw;
 	RedrawStatus _redrawStatus;
 	int			_lastScreenChangeID;
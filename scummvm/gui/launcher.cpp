@@ -22,6 +22,7 @@
 
 #include "base/version.h"
 
+#include "common/algorithm.h"
 #include "common/config-manager.h"
 #include "common/events.h"
 #include "common/fs.h"
@@ -89,10 +90,30 @@ enum {
 	kCmdSavePathClear = 'PSAC'
 };
 
+enum {
+	kPathCheckBudget = 10 ///< Milliseconds spent checking game paths per tickle
+};
+
+namespace {
+
+struct LauncherEntry {
+	Common::String description;
+	Common::String domain;
+};
+
+struct LauncherEntryComparator {
+	bool operator()(const LauncherEntry &x, const LauncherEntry &y) const {
+		const int cmp = scumm_stricmp(x.description.c_str(), y.description.c_str());
+		return cmp < 0 || (cmp == 0 && x.domain < y.domain);
+	}
+};
+
+} // End of anonymous namespace
+
 #pragma mark -
 
 LauncherDialog::LauncherDialog()
-	: Dialog(0, 0, 320, 200) {
+	: Dialog(0, 0, 320, 200), _nextPathCheck(0) {
 	_backgroundType = GUI::ThemeEngine::kDialogBackgroundMain;
 	const int screenW = g_system->getOverlayWidth();
 	const int screenH = g_system->getOverlayHeight();
@@ -246,12 +267,9 @@ void LauncherDialog::close() {
 }
 
 void LauncherDialog::updateListing() {
-	StringArray l;
-	ListWidget::ColorList colors;
-	ThemeEngine::FontColor color;
+	Common::Array<LauncherEntry> entries;
 
 	// Retrieve a list of all games defined in the config file
-	_domains.clear();
 	const ConfigManager::DomainMap &domains = ConfMan.getGameDomains();
 	ConfigManager::DomainMap::const_iterator iter;
 	for (iter = domains.begin(); iter != domains.end(); ++iter) {
@@ -265,7 +283,6 @@ void LauncherDialog::updateListing() {
 
 		String gameid(iter->_value.getVal("gameid"));
 		String description(iter->_value.getVal("description"));
-		Common::FSNode path(iter->_value.getVal("path"));
 
 		if (gameid.empty())
 			gameid = iter->_key;
@@ -280,30 +297,26 @@ void LauncherDialog::updateListing() {
 		}
 
 		if (!gameid.empty() && !description.empty()) {
-			// Insert the game into the launcher list
-			int pos = 0, size = l.size();
-
-			while (pos < size && (scumm_stricmp(description.c_str(), l[pos].c_str()) > 0))
-				pos++;
+			LauncherEntry entry;
+			entry.description = description;
+			entry.domain = iter->_key;
+			entries.push_back(entry);
+		}
+	}
 
-			color = ThemeEngine::kFontColorNormal;
-			if (!path.isDirectory()) {
-				color = ThemeEngine::kFontColorAlternate;
-				// If more conditions which grey out entries are added we should consider
-				// enabling this so that it is easy to spot why a certain game entry cannot
-				// be started.
+	// Sort once instead of inserting every game at its place, which got
+	// slow with thousands of games
+	Common::sort(entries.begin(), entries.end(), LauncherEntryComparator());
 
-				// description += Common::String::format(" (%s)", _("Not found"));
-			}
-
-			l.insert_at(pos, description);
-			colors.insert_at(pos, color);
-			_domains.insert_at(pos, iter->_key);
-		}
+	StringArray l;
+	_domains.clear();
+	for (uint i = 0; i < entries.size(); ++i) {
+		l.push_back(entries[i].description);
+		_domains.push_back(entries[i].domain);
 	}
 
 	const int oldSel = _list->getSelected();
-	_list->setList(l, &colors);
+	_list->setList(l);
 	if (oldSel < (int)l.size())
 		_list->setSelected(oldSel);	// Restore the old selection
 	else if (oldSel != -1)
@@ -314,6 +327,30 @@ void LauncherDialog::updateListing() {
 	// Update the filter settings, those are lost when "setList"
 	// is called.
 	_list->setFilter(_searchWidget->getEditString());
+
+	// Entries with missing game paths are greyed out from handleTickle()
+	_nextPathCheck = 0;
+}
+
+void LauncherDialog::checkGamePaths(uint32 budget) {
+	const uint32 start = g_system->getMillis();
+
+	while (_nextPathCheck < _domains.size() && g_system->getMillis() - start < budget) {
+		const Common::ConfigManager::Domain *domain = ConfMan.getDomain(_domains[_nextPathCheck]);
+		if (domain) {
+			Common::FSNode path(domain->getVal("path"));
+			if (!path.isDirectory()) {
+				_list->setItemColor(_nextPathCheck, ThemeEngine::kFontColorAlternate);
+				// If more conditions which grey out entries are added we should consider
+				// enabling this so that it is easy to spot why a certain game entry cannot
+				// be started.
+
+				// description += Common::String::format(" (%s)", _("Not found"));
+			}
+		}
+
+		++_nextPathCheck;
+	}
 }
 
 void LauncherDialog::addGame() {
@@ -528,6 +565,11 @@ void LauncherDialog::handleKeyUp(Common::KeyState state) {
 	updateButtons();
 }
 
+void LauncherDialog::handleTickle() {
+	checkGamePaths(kPathCheckBudget);
+	Dialog::handleTickle();
+}
+
 void LauncherDialog::handleOtherEvent(Common::Event evt) {
 	Dialog::handleOtherEvent(evt);
 	if (evt.type == Common::EVENT_DROP_FILE) {
@@ -52,6 +52,7 @@ public:
 	virtual void handleKeyDown(Common::KeyState state);
 	virtual void handleKeyUp(Common::KeyState state);
 	virtual void handleOtherEvent(Common::Event evt);
+	virtual void handleTickle();
 	bool doGameDetection(const Common::String &path);
 protected:
 	EditTextWidget  *_searchWidget;
@@ -68,6 +69,7 @@ protected:
 	StaticTextWidget	*_searchDesc;
 	ButtonWidget	*_searchClearButton;
 	StringArray		_domains;
+	uint			_nextPathCheck;
 	BrowserDialog	*_browser;
 	SaveLoadChooser	*_loadDialog;
 
@@ -81,6 +83,13 @@ protected:
 	 */
 	void updateListing();
 
+	/**
+	 * Grey out the games whose path is not a directory. Checking the paths
+	 * hits the file system, so it is spread over several calls and limited
+	 * to roughly @p budget milliseconds per call.
+	 */
+	void checkGamePaths(uint32 budget);
+
 	void updateButtons();
 	void switchButtonsText(ButtonWidget *button, const char *normalText, const char *shiftedText);
 
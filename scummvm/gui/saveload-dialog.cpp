@@ -130,10 +130,14 @@ enum {
 };
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
 
+enum {
+	kMetaInfoCacheSize = 64 ///< Number of saves whose meta info and thumbnail are kept
+};
+
 SaveLoadChooserDialog::SaveLoadChooserDialog(const Common::String &dialogName, const bool saveMode)
 	: Dialog(dialogName), _metaEngine(0), _delSupport(false), _metaInfoSupport(false),
 	_thumbnailSupport(false), _saveDateSupport(false), _playTimeSupport(false), _saveMode(saveMode),
-	_dialogWasShown(false)
+	_dialogWasShown(false), _listedGeneration(0)
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	, _listButton(0), _gridButton(0)
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
@@ -146,7 +150,7 @@ SaveLoadChooserDialog::SaveLoadChooserDialog(const Common::String &dialogName, c
 SaveLoadChooserDialog::SaveLoadChooserDialog(int x, int y, int w, int h, const bool saveMode)
 	: Dialog(x, y, w, h), _metaEngine(0), _delSupport(false), _metaInfoSupport(false),
 	_thumbnailSupport(false), _saveDateSupport(false), _playTimeSupport(false), _saveMode(saveMode),
-	_dialogWasShown(false)
+	_dialogWasShown(false), _listedGeneration(0)
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	, _listButton(0), _gridButton(0)
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
@@ -295,7 +299,17 @@ void SaveLoadChooserDialog::updateSaveList() {
 
 void SaveLoadChooserDialog::listSaves() {
 	if (!_metaEngine) return; //very strange
-	_saveList = _metaEngine->listSaves(_target.c_str());
+
+	// Engines usually open every save to read its description, so only do
+	// that again when the savefiles changed
+	const uint32 generation = g_system->getSavefileManager()->getSavefilesGeneration();
+	if (generation == 0 || generation != _listedGeneration || _target != _listedTarget) {
+		_listedSaves = _metaEngine->listSaves(_target.c_str());
+		_listedTarget = _target;
+		_listedGeneration = generation;
+		_metaInfoCache.clear();
+	}
+	_saveList = _listedSaves;
 
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 	//if there is Cloud support, add currently synced files as "locked" saves in the list
@@ -325,6 +339,43 @@ void SaveLoadChooserDialog::listSaves() {
 #endif
 }
 
+SaveStateDescriptor SaveLoadChooserDialog::getSaveMetaInfos(const SaveStateDescriptor &save) {
+	if (save.getLocked())
+		return save;
+
+	const int slot = save.getSaveSlot();
+	for (Common::List<MetaInfoCacheEntry>::iterator i = _metaInfoCache.begin(); i != _metaInfoCache.end(); ++i) {
+		if (i->slot == slot) {
+			MetaInfoCacheEntry entry = *i;
+			_metaInfoCache.erase(i);
+			_metaInfoCache.push_front(entry);
+			return entry.desc;
+		}
+	}
+
+	MetaInfoCacheEntry entry;
+	entry.slot = slot;
+	entry.desc = _metaEngine->querySaveMetaInfos(_target.c_str(), slot);
+	_metaInfoCache.push_front(entry);
+
+	if (_metaInfoCache.size() > kMetaInfoCacheSize)
+		_metaInfoCache.pop_back();
+
+	return entry.desc;
+}
+
+bool SaveLoadChooserDialog::hasSaveMetaInfos(const SaveStateDescriptor &save) const {
+	if (save.getLocked())
+		return true;
+
+	for (Common::List<MetaInfoCacheEntry>::const_iterator i = _metaInfoCache.begin(); i != _metaInfoCache.end(); ++i) {
+		if (i->slot == save.getSaveSlot())
+			return true;
+	}
+
+	return false;
+}
+
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 void SaveLoadChooserDialog::addChooserButtons() {
 	if (_listButton) {
@@ -553,7 +604,7 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 	_playtime->setLabel(_("No playtime saved"));
 
 	if (selItem >= 0 && _metaInfoSupport) {
-		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot()));
+		SaveStateDescriptor desc = getSaveMetaInfos(_saveList[selItem]);
 
 		isDeletable = desc.getDeletableFlag() && _delSupport;
 		isWriteProtected = desc.getWriteProtectedFlag();
@@ -735,6 +786,10 @@ enum {
 	kNewSaveCmd = 'SAVE'
 };
 
+enum {
+	kMetaInfoBudget = 10 ///< Milliseconds spent loading slot meta info per tickle
+};
+
 SaveLoadChooserGrid::SaveLoadChooserGrid(const Common::String &title, bool saveMode)
 	: SaveLoadChooserDialog("SaveLoadChooser", saveMode), _lines(0), _columns(0), _entriesPerPage(0),
 	_curPage(0), _newSaveContainer(0), _nextFreeSaveSlot(0), _buttons() {
@@ -1059,64 +1114,54 @@ void SaveLoadChooserGrid::hideButtons() {
 	for (ButtonArray::iterator i = _buttons.begin(), end = _buttons.end(); i != end; ++i) {
 		i->button->setGfx(0);
 		i->setVisible(false);
+		i->metaInfoPending = false;
 	}
 }
 
-void SaveLoadChooserGrid::updateSaves() {
-	hideButtons();
+void SaveLoadChooserGrid::handleTickle() {
+	SaveLoadChooserDialog::handleTickle();
 
-	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
-		const uint saveSlot = _saveList[i].getSaveSlot();
+	// Fill in the meta info of the visible slots a few at a time, so the
+	// page shows up before all the thumbnails are loaded
+	const uint32 start = g_system->getMillis();
+	bool updated = false;
 
-		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
+	for (uint curNum = 0, i = _curPage * _entriesPerPage; curNum < _buttons.size() && i < _saveList.size(); ++curNum, ++i) {
 		SlotButton &curButton = _buttons[curNum];
-		curButton.setVisible(true);
-		const Graphics::Surface *thumbnail = desc.getThumbnail();
-		if (thumbnail) {
-			curButton.button->setGfx(desc.getThumbnail());
-		} else {
-			curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
-		}
-		curButton.description->setLabel(Common::String::format("%d. %s", saveSlot, desc.getDescription().c_str()));
+		if (!curButton.metaInfoPending)
+			continue;
 
-		Common::String tooltip(_("Name: "));
-		tooltip += desc.getDescription();
+		if (g_system->getMillis() - start >= kMetaInfoBudget)
+			break;
 
-		if (_saveDateSupport) {
-			const Common::String &saveDate = desc.getSaveDate();
-			if (!saveDate.empty()) {
-				tooltip += "\n";
-				tooltip +=  _("Date: ") + saveDate;
-			}
+		updateSaveButton(curButton, _saveList[i].getSaveSlot(), getSaveMetaInfos(_saveList[i]));
+		updated = true;
+	}
 
-			const Common::String &saveTime = desc.getSaveTime();
-			if (!saveTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Time: ") + saveTime;
-			}
-		}
+	if (updated)
+		g_gui.scheduleTopDialogRedraw();
+}
 
-		if (_playTimeSupport) {
-			const Common::String &playTime = desc.getPlayTime();
-			if (!playTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Playtime: ") + playTime;
-			}
-		}
+void SaveLoadChooserGrid::updateSaves() {
+	hideButtons();
 
-		curButton.button->setTooltip(tooltip);
+	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
+		SlotButton &curButton = _buttons[curNum];
+		curButton.setVisible(true);
 
-		// In save mode we disable the button, when it's write protected.
-		// TODO: Maybe we should not display it at all then?
-		if (_saveMode && desc.getWriteProtectedFlag()) {
-			curButton.button->setEnabled(false);
+		if (hasSaveMetaInfos(_saveList[i])) {
+			updateSaveButton(curButton, _saveList[i].getSaveSlot(), getSaveMetaInfos(_saveList[i]));
 		} else {
-			curButton.button->setEnabled(true);
+			// Show what the save list already knows, the rest is loaded
+			// from handleTickle()
+			const SaveStateDescriptor &desc = _saveList[i];
+			curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
+			curButton.description->setLabel(Common::String::format("%d. %s", desc.getSaveSlot(), desc.getDescription().c_str()));
+			curButton.button->setTooltip(Common::String());
+			curButton.button->setEnabled(false);
+			curButton.description->setEnabled(true);
+			curButton.metaInfoPending = true;
 		}
-
-		//that would make it look "disabled" if slot is locked
-		curButton.button->setEnabled(!desc.getLocked());
-		curButton.description->setEnabled(!desc.getLocked());
 	}
 
 	const uint numPages = (_entriesPerPage != 0 && !_saveList.empty()) ? ((_saveList.size() + _entriesPerPage - 1) / _entriesPerPage) : 1;
@@ -1133,6 +1178,57 @@ void SaveLoadChooserGrid::updateSaves() {
 		_nextButton->setEnabled(false);
 }
 
+void SaveLoadChooserGrid::updateSaveButton(SlotButton &curButton, int saveSlot, const SaveStateDescriptor &desc) {
+	curButton.metaInfoPending = false;
+
+	const Graphics::Surface *thumbnail = desc.getThumbnail();
+	if (thumbnail) {
+		curButton.button->setGfx(desc.getThumbnail());
+	} else {
+		curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
+	}
+	curButton.description->setLabel(Common::String::format("%d. %s", saveSlot, desc.getDescription().c_str()));
+
+	Common::String tooltip(_("Name: "));
+	tooltip += desc.getDescription();
+
+	if (_saveDateSupport) {
+		const Common::String &saveDate = desc.getSaveDate();
+		if (!saveDate.empty()) {
+			tooltip += "\n";
+			tooltip +=  _("Date: ") + saveDate;
+		}
+
+		const Common::String &saveTime = desc.getSaveTime();
+		if (!saveTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Time: ") + saveTime;
+		}
+	}
+
+	if (_playTimeSupport) {
+		const Common::String &playTime = desc.getPlayTime();
+		if (!playTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Playtime: ") + playTime;
+		}
+	}
+
+	curButton.button->setTooltip(tooltip);
+
+	// In save mode we disable the button, when it's write protected.
+	// TODO: Maybe we should not display it at all then?
+	if (_saveMode && desc.getWriteProtectedFlag()) {
+		curButton.button->setEnabled(false);
+	} else {
+		curButton.button->setEnabled(true);
+	}
+
+	//that would make it look "disabled" if slot is locked
+	curButton.button->setEnabled(!desc.getLocked());
+	curButton.description->setEnabled(!desc.getLocked());
+}
+
 SavenameDialog::SavenameDialog()
 	: Dialog("SavenameDialog") {
 	_title = new StaticTextWidget(this, "SavenameDialog.DescriptionText", Common::String());
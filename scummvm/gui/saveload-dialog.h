@@ -26,6 +26,8 @@
 #include "gui/dialog.h"
 #include "gui/widgets/list.h"
 
+#include "common/list.h"
+
 #include "engines/metaengine.h"
 
 namespace GUI {
@@ -110,6 +112,16 @@ protected:
 	*/
 	virtual void listSaves();
 
+	/**
+	 * Get the meta info of a save, including its thumbnail. The results of
+	 * the most recently used saves are cached, because querying them from
+	 * the MetaEngine usually means reading and decoding a thumbnail.
+	 */
+	SaveStateDescriptor getSaveMetaInfos(const SaveStateDescriptor &save);
+
+	/** Whether getSaveMetaInfos() can answer without querying the MetaEngine. */
+	bool hasSaveMetaInfos(const SaveStateDescriptor &save) const;
+
 	const bool				_saveMode;
 	const MetaEngine		*_metaEngine;
 	bool					_delSupport;
@@ -121,6 +133,21 @@ protected:
 	bool _dialogWasShown;
 	SaveStateList			_saveList;
 
+	struct MetaInfoCacheEntry {
+		int slot;
+		SaveStateDescriptor desc;
+	};
+	/** Most recently used first, see getSaveMetaInfos() */
+	Common::List<MetaInfoCacheEntry> _metaInfoCache;
+
+	/**
+	 * Result of the last MetaEngine::listSaves() call, reused by listSaves()
+	 * as long as the savefiles of the same target did not change.
+	 */
+	SaveStateList			_listedSaves;
+	Common::String			_listedTarget;
+	uint32					_listedGeneration;
+
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	ButtonWidget *_listButton;
 	ButtonWidget *_gridButton;
@@ -194,6 +221,8 @@ public:
 	SaveLoadChooserGrid(const Common::String &title, bool saveMode);
 	~SaveLoadChooserGrid();
 
+	virtual void handleTickle();
+
 	virtual const Common::String &getResultString() const;
 
 	virtual void open();
@@ -227,12 +256,13 @@ private:
 	bool selectDescription();
 
 	struct SlotButton {
-		SlotButton() : container(0), button(0), description(0) {}
-		SlotButton(ContainerWidget *c, PicButtonWidget *b, StaticTextWidget *d) : container(c), button(b), description(d) {}
+		SlotButton() : container(0), button(0), description(0), metaInfoPending(false) {}
+		SlotButton(ContainerWidget *c, PicButtonWidget *b, StaticTextWidget *d) : container(c), button(b), description(d), metaInfoPending(false) {}
 
 		ContainerWidget  *container;
 		PicButtonWidget  *button;
 		StaticTextWidget *description;
+		bool metaInfoPending; ///< Shows the list description until handleTickle() loads the meta info
 
 		void setVisible(bool state) {
 			container->setVisible(state);
@@ -243,6 +273,7 @@ private:
 	void destroyButtons();
 	void hideButtons();
 	void updateSaves();
+	void updateSaveButton(SlotButton &curButton, int saveSlot, const SaveStateDescriptor &desc);
 };
 
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
@@ -205,6 +205,23 @@ void ListWidget::append(const String &s, ThemeEngine::FontColor color) {
 	scrollBarRecalc();
 }
 
+void ListWidget::setItemColor(int item, ThemeEngine::FontColor color) {
+	assert(item >= 0 && item < (int)_dataList.size());
+
+	if (_listColors.empty()) {
+		if (color == ThemeEngine::kFontColorNormal)
+			return;
+
+		for (uint i = 0; i < _dataList.size(); ++i)
+			_listColors.push_back(ThemeEngine::kFontColorNormal);
+	}
+
+	if (_listColors[item] != color) {
+		_listColors[item] = color;
+		markAsDirty();
+	}
+}
+
 void ListWidget::scrollTo(int item) {
 	int size = _list.size();
 	if (item >= size)
@@ -98,6 +98,9 @@ public:
 
 	void append(const String &s, ThemeEngine::FontColor color = ThemeEngine::kFontColorNormal);
 
+	/** Change the color of an item, indexed like getSelected(). */
+	void setItemColor(int item, ThemeEngine::FontColor color);
+
 	void setSelected(int item);
 	int getSelected() const						{ return (_filter.empty() || _selectedItem == -1) ? _selectedItem : _listIndex[_selectedItem]; }
 
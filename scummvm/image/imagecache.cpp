@@ -0,0 +1,114 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "image/imagecache.h"
+#include "image/image_decoder.h"
+
+#include "common/debug.h"
+#include "common/stream.h"
+
+namespace Image {
+
+ImageCache::ImageCache(uint32 budget) :
+	_budget(budget), _size(0), _useCounter(0), _hits(0), _misses(0) {
+}
+
+ImageCache::~ImageCache() {
+	if (_hits || _misses)
+		debug(2, "ImageCache: %u hits, %u misses, %u bytes cached", _hits, _misses, _size);
+
+	clear();
+}
+
+const CachedImage *ImageCache::findImage(const Common::String &key) {
+	EntryMap::iterator i = _entries.find(key);
+	if (i == _entries.end())
+		return 0;
+
+	++_hits;
+	i->_value.lastUsed = ++_useCounter;
+	return i->_value.image;
+}
+
+const CachedImage *ImageCache::addImage(const Common::String &key, Common::SeekableReadStream &stream, ImageDecoder &decoder) {
+	++_misses;
+
+	const Graphics::Surface *surface = decoder.loadStream(stream) ? decoder.getSurface() : 0;
+	if (!surface)
+		return 0;
+
+	EntryMap::iterator i = _entries.find(key);
+	if (i != _entries.end())
+		removeEntry(i);
+
+	CachedImage *image = new CachedImage();
+	image->surface.copyFrom(*surface);
+	image->paletteStartIndex = decoder.getPaletteStartIndex();
+	image->paletteColorCount = decoder.hasPalette() ? decoder.getPaletteColorCount() : 0;
+	image->palette = 0;
+	if (image->paletteColorCount) {
+		image->palette = new byte[image->paletteColorCount * 3];
+		memcpy(image->palette, decoder.getPalette(), image->paletteColorCount * 3);
+	}
+
+	Entry entry;
+	entry.image = image;
+	entry.size = image->surface.pitch * image->surface.h + image->paletteColorCount * 3;
+	entry.lastUsed = ++_useCounter;
+
+	// An image larger than the whole budget still gets stored, so the
+	// returned pointer stays valid; it is the first to go on the next miss
+	evict(entry.size);
+	_entries[key] = entry;
+	_size += entry.size;
+
+	return image;
+}
+
+void ImageCache::clear() {
+	while (!_entries.empty())
+		removeEntry(_entries.begin());
+}
+
+void ImageCache::removeEntry(EntryMap::iterator entry) {
+	CachedImage *image = entry->_value.image;
+	image->surface.free();
+	delete[] image->palette;
+	delete image;
+
+	_size -= entry->_value.size;
+	_entries.erase(entry);
+}
+
+void ImageCache::evict(uint32 needed) {
+	while (!_entries.empty() && _size + needed > _budget) {
+		EntryMap::iterator oldest = _entries.begin();
+		for (EntryMap::iterator i = _entries.begin(); i != _entries.end(); ++i) {
+			if (i->_value.lastUsed < oldest->_value.lastUsed)
+				oldest = i;
+		}
+
+		removeEntry(oldest);
+	}
+}
+
+} // End of namespace Image
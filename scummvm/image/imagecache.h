@@ -0,0 +1,125 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef IMAGE_IMAGECACHE_H
+#define IMAGE_IMAGECACHE_H
+
+#include "common/scummsys.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
+#include "common/noncopyable.h"
+#include "common/str.h"
+
+#include "graphics/surface.h"
+
+namespace Common {
+class SeekableReadStream;
+}
+
+namespace Image {
+
+class ImageDecoder;
+
+/**
+ * A decoded image as stored by ImageCache: a copy of the surface and
+ * palette the decoder produced.
+ */
+struct CachedImage {
+	Graphics::Surface surface;
+	byte *palette;
+	byte paletteStartIndex;
+	uint16 paletteColorCount;
+};
+
+/**
+ * Cache of decoded images, for assets which are decoded over and over
+ * again, like the GUI theme bitmaps on every theme or graphics mode change.
+ *
+ * Images are identified by a key chosen by the caller, usually the name of
+ * the archive they come from together with the name of the archive member.
+ * The cache holds up to a byte budget of decoded data and drops the least
+ * recently used images first.
+ */
+class ImageCache : Common::NonCopyable {
+public:
+	enum {
+		kDefaultBudget = 8 * 1024 * 1024
+	};
+
+	/**
+	 * @param budget    maximum total size of the decoded images in bytes.
+	 */
+	ImageCache(uint32 budget = kDefaultBudget);
+	~ImageCache();
+
+	/**
+	 * Look up an image.
+	 *
+	 * @param key   the key the image was added under.
+	 * @return the cached image, or 0 if it is not cached. It remains valid
+	 *         until the next call to addImage() or clear().
+	 */
+	const CachedImage *findImage(const Common::String &key);
+
+	/**
+	 * Decode an image and add it to the cache.
+	 *
+	 * @param key       the key to store the image under.
+	 * @param stream    the encoded image.
+	 * @param decoder   the decoder to use.
+	 * @return the decoded image, or 0 if decoding failed. It remains valid
+	 *         until the next call to addImage() or clear().
+	 */
+	const CachedImage *addImage(const Common::String &key, Common::SeekableReadStream &stream, ImageDecoder &decoder);
+
+	/**
+	 * Drop all cached images.
+	 */
+	void clear();
+
+	uint32 getSize() const { return _size; }
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+
+private:
+	struct Entry {
+		CachedImage *image;
+		uint32 size;
+		uint32 lastUsed;
+	};
+
+	typedef Common::HashMap<Common::String, Entry, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> EntryMap;
+	EntryMap _entries;
+
+	uint32 _budget;
+	uint32 _size;
+	uint32 _useCounter;
+	uint32 _hits;
+	uint32 _misses;
+
+	void removeEntry(EntryMap::iterator entry);
+	void evict(uint32 needed);
+};
+
+} // End of namespace Image
+
+#endif
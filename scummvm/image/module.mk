@@ -3,6 +3,7 @@ MODULE := image
 MODULE_OBJS := \
 	bmp.o \
 	iff.o \
+	imagecache.o \
 	jpeg.o \
 	pcx.o \
 	pict.o \
@@ -0,0 +1,201 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/decoders/adpcm.h"
+#include "audio/decoders/adpcm_intern.h"
+#include "audio/audiostream.h"
+
+#include "common/memstream.h"
+
+class ADPCMTestSuite : public CxxTest::TestSuite
+{
+private:
+	uint32 _seed;
+
+	byte nextRandom() {
+		_seed = _seed * 1103515245 + 12345;
+		return (_seed >> 16) & 0xff;
+	}
+
+	// Straightforward nibble by nibble decoders, as a reference for the
+	// block decoders
+	static int16 refDecodeIMA(int32 &last, int32 &stepIndex, byte code) {
+		int32 E = (2 * (code & 0x7) + 1) * Audio::Ima_ADPCMStream::_imaTable[stepIndex] / 8;
+		int32 diff = (code & 0x08) ? -E : E;
+		last = CLIP<int32>(last + diff, -32768, 32767);
+		stepIndex = CLIP<int32>(stepIndex + Audio::ADPCMStream::_stepAdjustTable[code], 0, 88);
+		return last;
+	}
+
+	static int refDecodeMSIma(const byte *block, uint32 size, int channels, int16 *out) {
+		int32 last[2], stepIndex[2];
+		for (int i = 0; i < channels; i++) {
+			last[i] = (int16)READ_LE_UINT16(block + 4 * i);
+			stepIndex[i] = (int16)READ_LE_UINT16(block + 4 * i + 2);
+		}
+
+		int samples = 0;
+		for (uint32 pos = 4 * channels; pos + 4 * channels <= size; pos += 4 * channels) {
+			for (int i = 0; i < channels; i++) {
+				for (int j = 0; j < 4; j++) {
+					byte data = block[pos + 4 * i + j];
+					out[samples + (j * 2) * channels + i] = refDecodeIMA(last[i], stepIndex[i], data & 0x0f);
+					out[samples + (j * 2 + 1) * channels + i] = refDecodeIMA(last[i], stepIndex[i], data >> 4);
+				}
+			}
+			samples += 8 * channels;
+		}
+
+		return samples;
+	}
+
+	struct MSStatus {
+		int16 delta, coeff1, coeff2, sample1, sample2;
+	};
+
+	static int16 refDecodeMS(MSStatus &c, byte code) {
+		static const int adaptationTable[] = {
+			230, 230, 230, 230, 307, 409, 512, 614,
+			768, 614, 512, 409, 307, 230, 230, 230
+		};
+
+		int32 predictor = (c.sample1 * c.coeff1 + c.sample2 * c.coeff2) / 256;
+		predictor += (signed)((code & 0x08) ? (code - 0x10) : code) * c.delta;
+		predictor = CLIP<int32>(predictor, -32768, 32767);
+
+		c.sample2 = c.sample1;
+		c.sample1 = predictor;
+		c.delta = (adaptationTable[code] * c.delta) >> 8;
+		if (c.delta < 16)
+			c.delta = 16;
+
+		return predictor;
+	}
+
+	static int refDecodeMS(const byte *block, uint32 size, int channels, int16 *out) {
+		static const int coeff1[] = { 256, 512, 0, 192, 240, 460, 392 };
+		static const int coeff2[] = { 0, -256, 0, 64, 0, -208, -232 };
+
+		MSStatus status[2];
+		for (int i = 0; i < channels; i++) {
+			status[i].coeff1 = coeff1[MIN<byte>(block[i], 6)];
+			status[i].coeff2 = coeff2[MIN<byte>(block[i], 6)];
+			status[i].delta = READ_LE_UINT16(block + channels + 2 * i);
+			status[i].sample1 = READ_LE_UINT16(block + 3 * channels + 2 * i);
+			status[i].sample2 = READ_LE_UINT16(block + 5 * channels + 2 * i);
+		}
+
+		int samples = 0;
+		for (int i = 0; i < channels; i++)
+			out[samples++] = status[i].sample2;
+		for (int i = 0; i < channels; i++)
+			out[samples++] = status[i].sample1;
+
+		for (uint32 pos = 7 * channels; pos < size; pos++) {
+			out[samples++] = refDecodeMS(status[0], block[pos] >> 4);
+			out[samples++] = refDecodeMS(status[channels - 1], block[pos] & 0x0f);
+		}
+
+		return samples;
+	}
+
+	byte *createBlocks(Audio::ADPCMType type, int channels, uint32 blockAlign, uint32 size) {
+		byte *data = new byte[size];
+		for (uint32 i = 0; i < size; i++)
+			data[i] = nextRandom();
+
+		// Keep the headers in range
+		for (uint32 block = 0; block < size; block += blockAlign) {
+			for (int i = 0; i < channels; i++) {
+				if (type == Audio::kADPCMMSIma) {
+					data[block + 4 * i + 2] = nextRandom() % 89;
+					data[block + 4 * i + 3] = 0;
+				} else {
+					data[block + i] = nextRandom() % 7;
+					data[block + channels + 2 * i + 1] &= 0x03;
+				}
+			}
+		}
+
+		return data;
+	}
+
+	void blockTestTemplate(Audio::ADPCMType type, int channels, uint32 blockAlign) {
+		_seed = blockAlign * channels;
+
+		const uint32 numBlocks = 8;
+		const uint32 size = blockAlign * numBlocks;
+		byte *data = createBlocks(type, channels, blockAlign, size);
+
+		const uint32 blockSamples = Audio::getADPCMBlockSamples(type, blockAlign, channels);
+		int16 *expected = new int16[blockSamples * numBlocks];
+		int16 *decoded = new int16[blockSamples * numBlocks];
+
+		for (uint32 block = 0; block < numBlocks; block++) {
+			const byte *src = data + block * blockAlign;
+			int16 *ref = expected + block * blockSamples;
+			int count = (type == Audio::kADPCMMSIma) ? refDecodeMSIma(src, blockAlign, channels, ref) : refDecodeMS(src, blockAlign, channels, ref);
+			TS_ASSERT_EQUALS((uint32)count, blockSamples);
+
+			TS_ASSERT_EQUALS(Audio::decodeADPCMBlock(type, src, blockAlign, channels, decoded), count);
+			TS_ASSERT_EQUALS(memcmp(ref, decoded, count * sizeof(int16)), 0);
+		}
+
+		// The stream has to produce the same samples, whatever the size of
+		// the reads
+		Audio::SeekableAudioStream *stream = Audio::makeADPCMStream(new Common::MemoryReadStream(data, size), DisposeAfterUse::YES, size, type, 22050, channels, blockAlign);
+		const int chunk = channels * 7;
+		int total = 0;
+		int read;
+		while ((read = stream->readBuffer(decoded + total, MIN<int>(chunk, blockSamples * numBlocks - total))) > 0)
+			total += read;
+
+		TS_ASSERT_EQUALS((uint32)total, blockSamples * numBlocks);
+		TS_ASSERT_EQUALS(memcmp(expected, decoded, total * sizeof(int16)), 0);
+		TS_ASSERT(stream->endOfData());
+
+		delete stream;
+		delete[] data;
+		delete[] expected;
+		delete[] decoded;
+	}
+
+public:
+	void test_ms_ima_mono() {
+		blockTestTemplate(Audio::kADPCMMSIma, 1, 256);
+	}
+
+	void test_ms_ima_stereo() {
+		blockTestTemplate(Audio::kADPCMMSIma, 2, 512);
+	}
+
+	void test_ms_mono() {
+		blockTestTemplate(Audio::kADPCMMS, 1, 256);
+	}
+
+	void test_ms_stereo() {
+		blockTestTemplate(Audio::kADPCMMS, 2, 1024);
+	}
+
+	void test_short_last_block() {
+		_seed = 42;
+
+		// Half a block: the header and whatever complete data follows
+		byte *data = createBlocks(Audio::kADPCMMS, 2, 256, 128);
+		int16 ref[512], decoded[512];
+		int count = refDecodeMS(data, 128, 2, ref);
+		TS_ASSERT_EQUALS(Audio::decodeADPCMBlock(Audio::kADPCMMS, data, 128, 2, decoded), count);
+		TS_ASSERT_EQUALS(memcmp(ref, decoded, count * sizeof(int16)), 0);
+		delete[] data;
+
+		// Too short for a header
+		byte header[8] = { 0 };
+		TS_ASSERT_EQUALS(Audio::decodeADPCMBlock(Audio::kADPCMMS, header, 8, 2, decoded), 0);
+	}
+
+	void test_unsupported_type() {
+		byte data[16] = { 0 };
+		int16 decoded[32];
+		TS_ASSERT_EQUALS(Audio::getADPCMBlockSamples(Audio::kADPCMOki, 16, 1), 0u);
+		TS_ASSERT_EQUALS(Audio::decodeADPCMBlock(Audio::kADPCMOki, data, 16, 1, decoded), -1);
+	}
+};
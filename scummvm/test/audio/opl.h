@@ -0,0 +1,128 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/softsynth/opl/dbopl.h"
+#include "common/util.h"
+
+#ifndef DISABLE_DOSBOX_OPL
+
+namespace {
+
+struct OplLogEntry {
+	uint16 delay; // Samples to render before this write
+	uint16 reg;
+	uint8 val;
+};
+
+// A short captured register log: three melodic channels (sustained, decaying
+// and slow attack), vibrato/tremolo, pitch bends, sustain level changes while
+// decaying, key offs with releases, and a rhythm mode section.
+static const OplLogEntry kOplLog[] = {
+	{    0, 0x01, 0x20 }, {    0, 0xBD, 0x00 }, {    0, 0x08, 0x00 },
+	{    0, 0x20, 0x21 }, {    0, 0x23, 0xE1 }, {    0, 0x40, 0x1A }, {    0, 0x43, 0x00 },
+	{    0, 0x60, 0xF2 }, {    0, 0x63, 0xF3 }, {    0, 0x80, 0x24 }, {    0, 0x83, 0x15 },
+	{    0, 0xE0, 0x00 }, {    0, 0xE3, 0x01 }, {    0, 0xC0, 0x0A },
+	{    0, 0x21, 0x01 }, {    0, 0x24, 0x02 }, {    0, 0x41, 0x10 }, {    0, 0x44, 0x05 },
+	{    0, 0x61, 0xA4 }, {    0, 0x64, 0xC6 }, {    0, 0x81, 0x57 }, {    0, 0x84, 0x48 },
+	{    0, 0xE1, 0x02 }, {    0, 0xE4, 0x00 }, {    0, 0xC1, 0x07 },
+	{    0, 0x22, 0x31 }, {    0, 0x25, 0x32 }, {    0, 0x42, 0x4F }, {    0, 0x45, 0x03 },
+	{    0, 0x62, 0x53 }, {    0, 0x65, 0x42 }, {    0, 0x82, 0x0F }, {    0, 0x85, 0x2F },
+	{    0, 0xE2, 0x03 }, {    0, 0xE5, 0x00 }, {    0, 0xC2, 0x0C },
+	{    0, 0xA0, 0x98 }, {    0, 0xB0, 0x31 },
+	{  441, 0xA1, 0x57 }, {    0, 0xB1, 0x2E },
+	{  441, 0xA2, 0x6B }, {    0, 0xB2, 0x2A },
+	{ 2205, 0xBD, 0xC0 },
+	{  735, 0xA0, 0xB0 }, {  735, 0xA0, 0xCA }, {  735, 0xA0, 0xE5 },
+	{ 1470, 0xB1, 0x0E }, { 3000, 0x41, 0x00 }, {    0, 0xB1, 0x32 },
+	{ 1102, 0x85, 0x7F }, {  500, 0x82, 0x3F },
+	{ 2205, 0xB0, 0x11 }, {    0, 0xB1, 0x12 }, {    0, 0xB2, 0x0A },
+	{ 4410, 0xBD, 0x20 },
+	{    0, 0x30, 0x01 }, {    0, 0x33, 0x01 }, {    0, 0x50, 0x0B }, {    0, 0x53, 0x00 },
+	{    0, 0x70, 0xD8 }, {    0, 0x73, 0xA8 }, {    0, 0x90, 0x4C }, {    0, 0x93, 0x6D },
+	{    0, 0xA6, 0x57 }, {    0, 0xB6, 0x0A }, {    0, 0xC6, 0x08 },
+	{    0, 0x31, 0x0C }, {    0, 0x34, 0x01 }, {    0, 0x51, 0x03 }, {    0, 0x54, 0x02 },
+	{    0, 0x71, 0xF8 }, {    0, 0x74, 0xF7 }, {    0, 0x91, 0xB5 }, {    0, 0x94, 0xB5 },
+	{    0, 0xA7, 0x03 }, {    0, 0xB7, 0x0A }, {    0, 0xA8, 0x41 }, {    0, 0xB8, 0x09 },
+	{    0, 0xBD, 0x31 }, { 2205, 0xBD, 0x20 }, { 1102, 0xBD, 0x3C }, { 2205, 0xBD, 0x20 },
+	{ 4410, 0xBD, 0x00 },
+	{ 2205, 0x00, 0x00 }
+};
+
+static const uint kOplLogRate = 22050;
+static const uint kOplMaxDelay = 4410;
+
+/**
+ * Plays kOplLog through a DBOPL chip and returns an FNV-1a hash of the
+ * 16-bit output. Samples are generated in chunks of at most maxChunk frames,
+ * so a large maxChunk renders whole blocks between register writes and
+ * maxChunk == 1 renders sample by sample.
+ */
+static uint32 renderOplLog(bool opl3, uint maxChunk, uint *nonSilent) {
+	using namespace OPL::DOSBox::DBOPL;
+
+	static int32 buffer[kOplMaxDelay * 2];
+
+	InitTables();
+	Chip *chip = new Chip();
+	chip->Setup(kOplLogRate);
+	if (opl3)
+		chip->WriteReg(0x105, 0x01);
+
+	const uint channels = opl3 ? 2 : 1;
+	uint32 hash = 2166136261U;
+	*nonSilent = 0;
+
+	for (uint i = 0; i < ARRAYSIZE(kOplLog); ++i) {
+		uint left = kOplLog[i].delay;
+		while (left > 0) {
+			const uint todo = MIN(left, maxChunk);
+			if (opl3)
+				chip->GenerateBlock3(todo, buffer);
+			else
+				chip->GenerateBlock2(todo, buffer);
+
+			for (uint j = 0; j < todo * channels; ++j) {
+				const int16 sample = (int16)buffer[j];
+				if (sample)
+					++*nonSilent;
+				hash = (hash ^ (uint16)sample) * 16777619U;
+			}
+			left -= todo;
+		}
+
+		chip->WriteReg(kOplLog[i].reg, kOplLog[i].val);
+	}
+
+	delete chip;
+	return hash;
+}
+
+} // End of anonymous namespace
+
+class OplTestSuite : public CxxTest::TestSuite {
+public:
+	void test_dbopl_opl2_log() {
+		uint blockNonSilent, sampleNonSilent;
+		const uint32 block = renderOplLog(false, kOplMaxDelay, &blockNonSilent);
+		const uint32 sample = renderOplLog(false, 1, &sampleNonSilent);
+
+		// Output of the emulator before block rendering was optimized
+		TS_ASSERT_EQUALS(block, 0x42c4853aU);
+		TS_ASSERT_EQUALS(sample, block);
+		TS_ASSERT_EQUALS(sampleNonSilent, blockNonSilent);
+		TS_ASSERT(blockNonSilent > 0);
+	}
+
+	void test_dbopl_opl3_log() {
+		uint blockNonSilent, sampleNonSilent;
+		const uint32 block = renderOplLog(true, kOplMaxDelay, &blockNonSilent);
+		const uint32 sample = renderOplLog(true, 1, &sampleNonSilent);
+
+		// Output of the emulator before block rendering was optimized
+		TS_ASSERT_EQUALS(block, 0xd7c1a5f5U);
+		TS_ASSERT_EQUALS(sample, block);
+		TS_ASSERT_EQUALS(sampleNonSilent, blockNonSilent);
+		TS_ASSERT(blockNonSilent > 0);
+	}
+};
+
+#endif // !DISABLE_DOSBOX_OPL
@@ -0,0 +1,124 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/lz4.h"
+#include "common/memstream.h"
+#include "common/random.h"
+
+class LZ4TestSuite : public CxxTest::TestSuite {
+	// Text-like data with repeats, long runs and a stretch of noise
+	static void fillTestData(byte *data, uint32 size) {
+		static const char text[] = "The quick brown fox jumps over the lazy dog. ";
+		uint32 seed = 12345;
+
+		for (uint32 i = 0; i < size; ++i) {
+			if ((i / 5000) % 3 == 0) {
+				data[i] = text[i % (sizeof(text) - 1)];
+			} else if ((i / 5000) % 3 == 1) {
+				data[i] = (i / 700) & 0xFF;
+			} else {
+				seed = seed * 1103515245 + 12345;
+				data[i] = seed >> 16;
+			}
+		}
+	}
+
+	public:
+	void test_block_roundtrip() {
+		static const uint32 sizes[] = { 0, 1, 12, 13, 17, 100, 4096, 65536 };
+
+		byte *data = new byte[65536];
+		byte *compressed = new byte[Common::compressLZ4Bound(65536)];
+		byte *decompressed = new byte[65536];
+		fillTestData(data, 65536);
+
+		for (uint i = 0; i < ARRAYSIZE(sizes); ++i) {
+			const uint32 size = sizes[i];
+			const uint32 compSize = Common::compressLZ4(compressed, Common::compressLZ4Bound(size), data, size);
+			TS_ASSERT(compSize > 0);
+			TS_ASSERT(Common::decompressLZ4(decompressed, size, compressed, compSize));
+			TS_ASSERT(memcmp(data, decompressed, size) == 0);
+		}
+
+		// Repetitive data has to shrink
+		memset(data, 'a', 65536);
+		const uint32 compSize = Common::compressLZ4(compressed, Common::compressLZ4Bound(65536), data, 65536);
+		TS_ASSERT(compSize > 0 && compSize < 1024);
+		TS_ASSERT(Common::decompressLZ4(decompressed, 65536, compressed, compSize));
+		TS_ASSERT(memcmp(data, decompressed, 65536) == 0);
+
+		// Wrong sizes and truncated data are rejected
+		TS_ASSERT(!Common::decompressLZ4(decompressed, 65535, compressed, compSize));
+		TS_ASSERT(!Common::decompressLZ4(decompressed, 65536, compressed, compSize - 1));
+
+		// A too small output buffer makes compression fail
+		TS_ASSERT_EQUALS(Common::compressLZ4(compressed, 4, data, 65536), 0U);
+
+		delete[] data;
+		delete[] compressed;
+		delete[] decompressed;
+	}
+
+	void test_stream_roundtrip() {
+		const uint32 size = 200000;
+		byte *data = new byte[size];
+		fillTestData(data, size);
+
+		Common::MemoryWriteStreamDynamic *out = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+		Common::WriteStream *lz4 = Common::wrapLZ4WriteStream(out);
+		// Write in odd sized chunks to cross block boundaries
+		for (uint32 pos = 0; pos < size; pos += 777)
+			TS_ASSERT_EQUALS(lz4->write(data + pos, MIN<uint32>(777, size - pos)), MIN<uint32>(777, size - pos));
+		TS_ASSERT_EQUALS(lz4->pos(), (int32)size);
+		lz4->finalize();
+		TS_ASSERT(!lz4->err());
+
+		const uint32 compSize = out->size();
+		byte *compressed = out->getData();
+		delete lz4;
+
+		Common::SeekableReadStream *in = new Common::MemoryReadStream(compressed, compSize, DisposeAfterUse::YES);
+		TS_ASSERT(Common::isLZ4Stream(in));
+		TS_ASSERT_EQUALS(in->pos(), 0);
+
+		Common::SeekableReadStream *stream = Common::wrapLZ4ReadStream(in);
+		TS_ASSERT_EQUALS(stream->size(), (int32)size);
+
+		byte *decompressed = new byte[size];
+		TS_ASSERT_EQUALS(stream->read(decompressed, size), size);
+		TS_ASSERT(memcmp(data, decompressed, size) == 0);
+		TS_ASSERT(!stream->eos());
+		byte extra;
+		TS_ASSERT_EQUALS(stream->read(&extra, 1), 0U);
+		TS_ASSERT(stream->eos());
+		TS_ASSERT(!stream->err());
+
+		// Seek forward across blocks, backward, and within a block
+		static const int32 positions[] = { 150000, 65536, 65535, 10, 131072, 199999, 0, 70000, 69990 };
+		for (uint i = 0; i < ARRAYSIZE(positions); ++i) {
+			TS_ASSERT(stream->seek(positions[i]));
+			TS_ASSERT_EQUALS(stream->pos(), positions[i]);
+			const uint32 n = MIN<uint32>(1000, size - positions[i]);
+			TS_ASSERT_EQUALS(stream->read(decompressed, n), n);
+			TS_ASSERT(memcmp(data + positions[i], decompressed, n) == 0);
+		}
+
+		TS_ASSERT(stream->seek(-10, SEEK_END));
+		TS_ASSERT_EQUALS(stream->read(decompressed, 100), 10U);
+		TS_ASSERT(memcmp(data + size - 10, decompressed, 10) == 0);
+
+		delete stream;
+		delete[] decompressed;
+		delete[] data;
+	}
+
+	void test_not_lz4() {
+		static const byte gzip[] = { 0x1F, 0x8B, 0x08, 0x00, 0x00 };
+		Common::MemoryReadStream stream(gzip, sizeof(gzip));
+		TS_ASSERT(!Common::isLZ4Stream(&stream));
+		TS_ASSERT_EQUALS(stream.pos(), 0);
+
+		Common::MemoryReadStream shortStream(gzip, 2);
+		TS_ASSERT(!Common::isLZ4Stream(&shortStream));
+		TS_ASSERT_EQUALS(shortStream.pos(), 0);
+	}
+};
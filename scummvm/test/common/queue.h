@@ -79,4 +79,35 @@ public:
 		TS_ASSERT(!q1.empty());
 		TS_ASSERT(!q2.empty());
 	}
+
+	void test_fixed_queue() {
+		Common::FixedQueue<int, 4> queue;
+		TS_ASSERT(queue.empty());
+		TS_ASSERT_EQUALS(queue.size(), 0u);
+
+		queue.push(1);
+		queue.push(2);
+		queue.push(3);
+		TS_ASSERT_EQUALS(queue.front(), 1);
+		TS_ASSERT_EQUALS(queue.back(), 3);
+		TS_ASSERT_EQUALS(queue.pop(), 1);
+
+		// Wrap around the end of the ring
+		queue.push(4);
+		queue.push(5);
+		TS_ASSERT(queue.full());
+		TS_ASSERT_EQUALS(queue.size(), 4u);
+		TS_ASSERT_EQUALS(queue.back(), 5);
+
+		queue.back() = 6;
+		for (int i = 2; i <= 4; ++i)
+			TS_ASSERT_EQUALS(queue.pop(), i);
+		TS_ASSERT_EQUALS(queue.pop(), 6);
+		TS_ASSERT(queue.empty());
+
+		queue.push(7);
+		queue.clear();
+		TS_ASSERT(queue.empty());
+		TS_ASSERT(!queue.full());
+	}
 };